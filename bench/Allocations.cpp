@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * @file Allocations.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the heap allocation counter of the benchmark.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "Allocations.hpp"
+
+#include <cstdlib>
+#include <atomic>
+#include <new>
+
+namespace
+{
+std::atomic<uint64_t> allocation_count {0};
+}  // namespace
+
+auto Allocations::GetCount() noexcept -> uint64_t
+{
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+auto operator new(size_t size) -> void *
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (auto * pointer = std::malloc(size == 0 ? 1 : size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc {};
+}
+
+auto operator new[](size_t size) -> void *
+{
+    return ::operator new(size);
+}
+
+void operator delete(void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void * pointer, size_t size) noexcept
+{
+    static_cast<void>(size);
+    std::free(pointer);
+}
+
+void operator delete[](void * pointer, size_t size) noexcept
+{
+    static_cast<void>(size);
+    std::free(pointer);
+}
@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * @file Allocations.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the heap allocation counter of the benchmark.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace Allocations
+{
+/**
+ * Gets the number of calls to the global operator new since the program
+ * started, counted by the replacement operators of the benchmark.
+ *
+ * @return The number of allocations
+ */
+[[nodiscard]] auto GetCount() noexcept -> uint64_t;
+}  // namespace Allocations
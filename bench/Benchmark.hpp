@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * @file Benchmark.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the Benchmark class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "Allocations.hpp"
+
+#include <string_view>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal timing harness. Every operation is first calibrated so that a run
+ * takes long enough to be measured reliably, then it is run a few times and
+ * the fastest run is kept, which filters out most of the scheduling noise.
+ */
+class Benchmark final
+{
+ public:
+
+    /**
+     * Measurement of one operation.
+     */
+    struct Result
+    {
+        std::string name;
+        double ns_per_op;
+        uint64_t iterations;
+        double allocations_per_op;
+        double nodes_per_second; /* Negative if the operation does not search */
+    };
+
+    /**
+     * Gets the number of nodes visited so far by a search.
+     */
+    using NodeCounter = std::function<uint64_t()>;
+
+ private:
+
+    using clock = std::chrono::steady_clock;
+
+    static constexpr uint64_t MIN_RUN_DURATION = 20'000'000;  // ns
+    static constexpr uint8_t RUNS = 5;
+
+    std::vector<Result> results;
+
+    /**
+     * Runs an operation a number of times.
+     *
+     * @param operation The operation, called with the iteration index
+     * @param iterations The number of iterations
+     * @return The elapsed time in nanoseconds
+     */
+    template <typename Operation>
+    static auto Time(Operation & operation, uint64_t iterations) noexcept -> uint64_t;
+
+ public:
+
+    /**
+     * Measures an operation and records the result.
+     *
+     * @param name The name of the measurement
+     * @param operation The operation, called with the iteration index
+     * @param node_counter The node counter of the search run by the operation
+     * @return The result
+     */
+    template <typename Operation>
+    auto Run(std::string_view name, Operation && operation, NodeCounter const & node_counter = {}) -> Result const &;
+
+    /**
+     * Prevents the compiler from optimising away the computation of a value.
+     *
+     * @param value The value
+     */
+    template <typename T>
+    static void KeepAlive(T const & value) noexcept;
+
+    /**
+     * Gets the recorded results.
+     *
+     * @return The results
+     */
+    [[nodiscard]] auto GetResults() const noexcept -> std::vector<Result> const &;
+};
+
+template <typename Operation>
+auto Benchmark::Time(Operation & operation, uint64_t iterations) noexcept -> uint64_t
+{
+    auto const START = clock::now();
+    for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        operation(iteration);
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - START).count());
+}
+
+template <typename Operation>
+auto Benchmark::Run(std::string_view name, Operation && operation, NodeCounter const & node_counter) -> Result const &
+{
+    uint64_t iterations = 1;
+    while (Time(operation, iterations) < MIN_RUN_DURATION)
+    {
+        iterations *= 2;
+    }
+
+    auto const START_ALLOCATIONS = Allocations::GetCount();
+    auto const START_NODES = node_counter ? node_counter() : 0;
+
+    uint64_t fastest_run = UINT64_MAX;
+    uint64_t total_time = 0;
+    for (uint8_t run = 0; run < RUNS; ++run)
+    {
+        auto const ELAPSED = Time(operation, iterations);
+        fastest_run = std::min(fastest_run, ELAPSED);
+        total_time += ELAPSED;
+    }
+
+    auto const TOTAL_ITERATIONS = static_cast<double>(iterations * RUNS);
+    auto const ALLOCATIONS = static_cast<double>(Allocations::GetCount() - START_ALLOCATIONS);
+    auto const NODES = node_counter ? static_cast<double>(node_counter() - START_NODES) : -1.0;
+
+    results.push_back({std::string {name},
+                       static_cast<double>(fastest_run) / static_cast<double>(iterations),
+                       iterations,
+                       ALLOCATIONS / TOTAL_ITERATIONS,
+                       node_counter ? NODES * 1e9 / static_cast<double>(total_time) : -1.0});
+    return results.back();
+}
+
+template <typename T>
+void Benchmark::KeepAlive(T const & value) noexcept
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline auto Benchmark::GetResults() const noexcept -> std::vector<Result> const &
+{
+    return results;
+}
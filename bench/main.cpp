@@ -0,0 +1,1093 @@
+/*******************************************************************************
+ * @file main.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Entry point of the host benchmark. Measures the board primitives and
+ *        the move latency of every strategy, checks that both searches agree
+ *        with the perfect-play table, measures how the parallel search scales
+ *        with its lanes and prints everything as JSON, so the output of two
+ *        commits can be diffed.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "SearchStatistics.hpp"
+#include "MonteCarloSearch.hpp"
+#include "IPlayerStrategy.hpp"
+#include "BoardManager.hpp"
+#include "PositionIndex.hpp"
+#include "PerfectPlay.hpp"
+#include "GridSearch.hpp"
+#include "SearchPool.hpp"
+#include "Benchmark.hpp"
+#include "BitBoard.hpp"
+#include "HD44780.hpp"
+#include "LCD_I2C.hpp"
+#include "Host.hpp"
+
+#include <cstdlib>
+#include <chrono>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using Utility::PlayerSymbol;
+using Utility::Board;
+
+namespace
+{
+constexpr uint8_t MIDGAME_MIN_MOVES = 2;
+constexpr uint8_t MIDGAME_MAX_MOVES = 6;
+constexpr uint32_t TIME_BUDGET = 10'000;
+constexpr uint32_t TIME_BUDGET_TOLERANCE = 1'000;
+constexpr uint8_t PARALLEL_DEPTH = 3;
+constexpr uint8_t PARALLEL_RUNS = 3;
+constexpr uint8_t MIN_PARALLEL_LANES = 4;
+constexpr uint32_t MCTS_NODES_15X15 = 65'536;
+constexpr uint8_t LCD_ADDRESS = 0x27;
+constexpr uint8_t LCD_SCREENS = 64;
+constexpr uint LCD_BUS_SPEED = 400'000;
+constexpr uint8_t EEPROM_ADDRESS = 0x50;
+constexpr uint8_t EEPROM_PAGE_SIZE = 16;
+constexpr uint8_t ABSENT_ADDRESS = 0x51;
+constexpr uint8_t ABSENT_WRITES = 4;
+
+constexpr std::array<MoveOrdering, 4> ORDERINGS {MoveOrdering::NONE, MoveOrdering::STATIC, MoveOrdering::KILLERS,
+                                                  MoveOrdering::HISTORY};
+constexpr std::array<char const *, 4> ORDERING_NAMES {"none", "static", "killers", "history"};
+
+/**
+ * Nodes visited by the searches with one move ordering.
+ */
+struct OrderingEffort
+{
+    uint32_t hard_3x3 {0};   /* Cold HardStrategy search from the empty board */
+    uint32_t grid_5x5 {0};   /* GridSearch of a 5x5 four-in-a-row mid-game to depth 4 */
+    uint32_t grid_15x15 {0}; /* GridSearch of a 15x15 gomoku mid-game to depth 2 */
+};
+
+/**
+ * Outcome of a search with a time budget.
+ */
+struct TimedSearch
+{
+    uint8_t depth {0};    /* Depth of the last completed iteration */
+    uint32_t elapsed {0}; /* Wall time of the whole search in microseconds */
+};
+
+/**
+ * Parallel search of a 15x15 mid-game position with a number of lanes.
+ */
+struct ParallelSearch
+{
+    uint8_t lanes {0};    /* Lanes of the search, including the caller */
+    uint32_t elapsed {0}; /* Fastest wall time of a search in microseconds */
+    uint32_t nodes {0};   /* Nodes visited by all the lanes */
+    bool same_move {false}; /* Whether the move is the one found by a single lane */
+};
+
+/**
+ * Speed and strength of the Monte Carlo tree search.
+ */
+struct MonteCarloEffort
+{
+    uint32_t playouts_per_second_3x3 {0};   /* MctsStrategy from the empty board */
+    uint32_t playouts_per_second_15x15 {0}; /* Search of a 15x15 gomoku mid-game */
+    size_t positions {0};                   /* Mid-game positions checked against the table */
+    size_t mismatches {0};                  /* Positions where the move is not among the best ones */
+};
+
+/**
+ * Cost of updating the whole LCD screen through the output queue.
+ */
+struct LcdQueueEffort
+{
+    uint32_t enqueue {0};          /* Mean time of Flush in microseconds */
+    uint32_t drain {0};            /* Mean time until the queue is empty in microseconds */
+    uint32_t bytes_per_second {0}; /* Expander bytes written per second by the DMA channel */
+    uint32_t bus {0};              /* Mean bus time of the display timing model in microseconds */
+    size_t screens {0};            /* Screens drawn */
+    size_t mismatches {0};         /* Rows not shown as they were drawn */
+    size_t violations {0};         /* Writes that broke the timing of the display */
+};
+
+/**
+ * Traffic of the I2C bus shared by the display, an EEPROM and a device that
+ * does not answer.
+ */
+struct BusEffort
+{
+    uint baud_rate {0};                           /* Speed found by the probe */
+    std::array<uint8_t, 3> addresses {};
+    std::array<I2CBus::Statistics, 3> devices {};
+    size_t mismatches {0};                        /* EEPROM bytes not read back as written */
+};
+
+/**
+ * Everything measured besides the timings of the benchmark.
+ */
+struct Results
+{
+    SearchStatistics search {};                          /* Cold search from the empty board */
+    HardStrategy::Line line {};                          /* Principal variation of the same search */
+    size_t corpus_size {0};                              /* Mid-game positions */
+    size_t checked {0};                                  /* Positions checked against the table */
+    size_t table_mismatches {0};                         /* Disagreements of the table with minimax */
+    size_t mismatches {0};                               /* Disagreements of the search with the table */
+    size_t grid_mismatches {0};                          /* Disagreements of the generic search */
+    size_t parallel_mismatches {0};                      /* Disagreements of the parallel generic search */
+    uint8_t parallel_lanes {0};                          /* Lanes of the same search */
+    TimedSearch timed {};
+    std::array<OrderingEffort, ORDERINGS.size()> orderings {};
+    std::vector<ParallelSearch> parallel {};
+    MonteCarloEffort monte_carlo {};
+    LcdQueueEffort lcd_queue {};
+    BusEffort i2c_bus {};
+};
+
+/**
+ * Collects every reachable non-terminal position.
+ *
+ * @param board The position to start from
+ * @param visited The keys of the positions found so far
+ * @param positions The positions found so far
+ */
+void Collect_Positions(BitBoard & board, std::vector<bool> & visited, std::vector<BitBoard> & positions)
+{
+    if (visited[board.GetKey()] || board.IsTerminal())
+    {
+        return;
+    }
+    visited[board.GetKey()] = true;
+    positions.push_back(board);
+
+    auto const PLAYER = board.GetCurrentPlayer();
+    for (BitBoard::mask actions = board.GetEmpty(); actions != 0; actions &= actions - 1)
+    {
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+
+        board.MakeMove(CELL, PLAYER);
+        Collect_Positions(board, visited, positions);
+        board.UnmakeMove(CELL);
+    }
+}
+
+/**
+ * Builds the mid-game corpus: the canonical reachable positions with a few
+ * pieces already placed, in a fixed order so that every run sees the same
+ * inputs.
+ *
+ * @param positions Every reachable non-terminal position
+ * @return The corpus
+ */
+auto Make_Midgame_Corpus(std::vector<BitBoard> const & positions) -> std::vector<Board>
+{
+    std::vector<Board> corpus {};
+
+    for (auto const & POSITION: positions)
+    {
+        auto const MOVES = POSITION.GetMoveCount();
+        if (MOVES >= MIDGAME_MIN_MOVES && MOVES <= MIDGAME_MAX_MOVES &&
+                BoardManager::Canonicalise(POSITION).first == POSITION)
+        {
+            corpus.push_back(POSITION.ToBoard());
+        }
+    }
+    return corpus;
+}
+
+/**
+ * Plain minimax, with no table, book, pruning or ordering, to check the
+ * perfect-play table against something that shares none of its code.
+ *
+ * @param board The position, restored before returning
+ * @return The value of the position (1 if X wins, -1 if O wins, 0 for a tie)
+ */
+auto Minimax(BitBoard & board) noexcept -> Utility::Value
+{
+    if (board.IsTerminal())
+    {
+        return board.GetValue();
+    }
+
+    auto const PLAYER = board.GetCurrentPlayer();
+    auto const SIGN = static_cast<Utility::Value>((PLAYER == PlayerSymbol::X) ? 1 : -1);
+    auto best = static_cast<Utility::Value>(-2);
+    for (BitBoard::mask actions = board.GetEmpty(); actions != 0; actions &= actions - 1)
+    {
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+
+        board.MakeMove(CELL, PLAYER);
+        best = std::max(best, static_cast<Utility::Value>(SIGN * Minimax(board)));
+        board.UnmakeMove(CELL);
+    }
+    return static_cast<Utility::Value>(SIGN * best);
+}
+
+/**
+ * Checks the value and the best moves of the perfect-play table against plain
+ * minimax on every reachable position.
+ *
+ * @param positions The positions to be checked
+ * @return The number of positions where the two disagree
+ */
+auto Count_Table_Mismatches(std::vector<BitBoard> const & positions) noexcept -> size_t
+{
+    size_t mismatches = 0;
+
+    for (auto position: positions)
+    {
+        auto const PLAYER = position.GetCurrentPlayer();
+        auto const VALUE = Minimax(position);
+        BitBoard::mask best_moves = 0;
+
+        for (BitBoard::mask actions = position.GetEmpty(); actions != 0; actions &= actions - 1)
+        {
+            auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+
+            position.MakeMove(CELL, PLAYER);
+            if (Minimax(position) == VALUE)
+            {
+                best_moves |= static_cast<BitBoard::mask>(1U << CELL);
+            }
+            position.UnmakeMove(CELL);
+        }
+
+        if (PerfectPlay::GetValue(position) != VALUE || PerfectPlay::GetBestMoves(position) != best_moves)
+        {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * Checks that every move chosen by the search is one of the best moves found
+ * in the perfect-play table. The opening book is copied from the table, so it
+ * is turned off to check the search itself.
+ *
+ * @param positions The positions to be checked
+ * @return The number of positions where the two disagree
+ */
+auto Count_Search_Mismatches(std::vector<BitBoard> const & positions) noexcept -> size_t
+{
+    HardStrategy search {HardStrategy::Mode::SEARCH};
+    search.SetOpeningBook(false);
+    size_t mismatches = 0;
+
+    for (auto const & POSITION: positions)
+    {
+        auto const CELL = BitBoard::CellFromMove(search.GetNextMove(POSITION.ToBoard()));
+        if (!((PerfectPlay::GetBestMoves(POSITION) >> CELL) & 1U))
+        {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * Checks that the generic search of the 3x3 board, without a depth limit,
+ * only chooses moves that are among the best ones in the perfect-play table.
+ *
+ * @param positions The positions to be checked
+ * @param lanes The number of lanes of the search
+ * @return The number of positions where the two disagree
+ */
+auto Count_Grid_Search_Mismatches(std::vector<BitBoard> const & positions, uint8_t lanes) -> size_t
+{
+    GridSearch<3, 3> search {};
+    std::vector<GridSearch<3, 3>> helpers(lanes - 1U);
+    auto table = std::make_unique<GridSearch<3, 3>::Table>();
+    if (lanes > 1)
+    {
+        search.SetHelpers(helpers);
+        search.SetTranspositionTable(table.get());
+    }
+    size_t mismatches = 0;
+
+    for (auto const & POSITION: positions)
+    {
+        GridBoard<3, 3> board {};
+        for (uint8_t cell = 0; cell < BitBoard::CELLS; ++cell)
+        {
+            if (POSITION.GetCell(cell) != PlayerSymbol::UNK)
+            {
+                board.MakeMove(cell, POSITION.GetCell(cell));
+            }
+        }
+
+        auto const CELL = search.Search(board).move;
+        if (CELL >= BitBoard::CELLS || !((PerfectPlay::GetBestMoves(POSITION) >> CELL) & 1U))
+        {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * Builds a mid-game position of a large board: a few pieces around the
+ * centre, with no line of more than two.
+ *
+ * @return The position
+ */
+template <uint8_t N, uint8_t K>
+auto Make_Grid_Midgame() noexcept -> GridBoard<N, K>
+{
+    static constexpr uint8_t CENTRE = N / 2;
+    static constexpr std::array<std::array<int8_t, 2>, 4> OFFSETS {{{0, 0}, {1, 1}, {0, 1}, {-1, 0}}};
+
+    GridBoard<N, K> board {};
+    for (auto const & [ROW, COLUMN]: OFFSETS)
+    {
+        auto const CELL = GridBoard<N, K>::GetCell(static_cast<uint8_t>(CENTRE + ROW),
+                                                   static_cast<uint8_t>(CENTRE + COLUMN));
+        board.MakeMove(CELL, board.GetCurrentPlayer());
+    }
+    return board;
+}
+
+/**
+ * Measures the move latency of the generic search on a large board.
+ *
+ * @param benchmark The benchmark
+ * @param name The name of the board and evaluator in the results
+ * @param depth_limit The number of plies searched below the root
+ */
+template <uint8_t N, uint8_t K, typename Evaluator = LineEvaluator<N, K>>
+void Measure_Grid_Search(Benchmark & benchmark, std::string_view name, uint8_t depth_limit)
+{
+    GridSearch<N, K, Evaluator> search {depth_limit};
+    auto board = Make_Grid_Midgame<N, K>();
+
+    uint64_t nodes = 0;
+    auto const NODE_COUNTER = GridSearch<N, K, Evaluator>::Statistics::ENABLED ?
+                              Benchmark::NodeCounter {[&nodes] {return nodes;}} : Benchmark::NodeCounter {};
+
+    benchmark.Run(std::string {name} + ".depth_" + std::to_string(depth_limit), [&](uint64_t)
+    {
+        Benchmark::KeepAlive(search.Search(board));
+        nodes += search.GetSearchStatistics().nodes;
+    }, NODE_COUNTER);
+}
+
+/**
+ * Runs an iterative deepening search of a 15x15 mid-game position within
+ * the time budget.
+ *
+ * @return The depth reached and the time taken
+ */
+auto Run_Timed_Grid_Search() noexcept -> TimedSearch
+{
+    GridSearch<15, 5> search {};
+    search.SetTimeBudget(TIME_BUDGET);
+    auto board = Make_Grid_Midgame<15, 5>();
+
+    auto const START = time_us_64();
+    auto const RESULT = search.Search(board);
+    return {RESULT.depth, static_cast<uint32_t>(time_us_64() - START)};
+}
+
+/**
+ * Times a depth-limited search of a 15x15 mid-game position with every
+ * power of two of lanes up to the number of hardware threads (and at least
+ * two), all of them sharing a transposition table.
+ *
+ * @return The searches, starting with the single lane one
+ */
+auto Measure_Parallel_Search() -> std::vector<ParallelSearch>
+{
+    using Search = GridSearch<15, 5>;
+
+    auto const MAX_LANES = std::max<uint8_t>(SearchPool::GetLaneCount(), 2);
+    auto table = std::make_unique<Search::Table>();
+    std::vector<ParallelSearch> searches {};
+    Search::cell single_lane_move = Search::Board::CELLS;
+
+    for (uint8_t lanes = 1; ; lanes = static_cast<uint8_t>(std::min(2 * lanes, int {MAX_LANES})))
+    {
+        Search search {PARALLEL_DEPTH};
+        std::vector<Search> helpers(lanes - 1U, Search {PARALLEL_DEPTH});
+        search.SetHelpers(helpers);
+        search.SetTranspositionTable(table.get());
+
+        ParallelSearch parallel {lanes, UINT32_MAX, 0, true};
+        for (uint8_t run = 0; run < PARALLEL_RUNS; ++run)
+        {
+            auto board = Make_Grid_Midgame<15, 5>();
+            auto const START = time_us_64();
+            auto const RESULT = search.Search(board);
+            parallel.elapsed = std::min(parallel.elapsed, static_cast<uint32_t>(time_us_64() - START));
+            parallel.nodes = search.GetSearchStatistics().nodes;
+
+            if (lanes == 1)
+            {
+                single_lane_move = RESULT.move;
+            }
+            parallel.same_move = parallel.same_move && RESULT.move == single_lane_move;
+        }
+        searches.push_back(parallel);
+
+        if (lanes == MAX_LANES)
+        {
+            return searches;
+        }
+    }
+}
+
+/**
+ * Measures the playouts per second of the Monte Carlo tree search and checks
+ * how often its moves are among the best ones of the perfect-play table.
+ *
+ * @param corpus The mid-game corpus
+ * @return The speed and strength
+ */
+auto Measure_Monte_Carlo(std::vector<Board> const & corpus) -> MonteCarloEffort
+{
+    MonteCarloEffort effort {};
+
+    MctsStrategy strategy {};
+    Benchmark::KeepAlive(strategy.GetNextMove(Board {}));
+    effort.playouts_per_second_3x3 = strategy.GetSearch().GetPlayoutsPerSecond();
+
+    auto gomoku = std::make_unique<MonteCarloSearch<15, 5, MCTS_NODES_15X15>>();
+    Benchmark::KeepAlive(gomoku->Search(Make_Grid_Midgame<15, 5>(), MctsStrategy::DEFAULT_PLAYOUTS));
+    effort.playouts_per_second_15x15 = gomoku->GetPlayoutsPerSecond();
+
+    for (auto const & POSITION: corpus)
+    {
+        auto const CELL = BitBoard::CellFromMove(strategy.GetNextMove(POSITION));
+        if (!((PerfectPlay::GetBestMoves(BitBoard {POSITION}) >> CELL) & 1U))
+        {
+            ++effort.mismatches;
+        }
+    }
+    effort.positions = corpus.size();
+    return effort;
+}
+
+/**
+ * Emulated EEPROM: the first byte of a write sets the memory address, the
+ * next ones are stored from it, and reads continue from it.
+ */
+std::array<uint8_t, 256> eeprom {};
+uint8_t eeprom_address {0};
+
+/**
+ * Gets the EEPROM page written while drawing a screen.
+ *
+ * @param round The screen
+ * @return The bytes
+ */
+auto Get_EEPROM_Page(uint8_t round) noexcept -> std::array<uint8_t, EEPROM_PAGE_SIZE + 1>
+{
+    std::array<uint8_t, EEPROM_PAGE_SIZE + 1> page {};
+
+    page[0] = static_cast<uint8_t>(round * EEPROM_PAGE_SIZE);
+    for (uint8_t index = 1; index < page.size(); ++index)
+    {
+        page[index] = static_cast<uint8_t>(round + index);
+    }
+    return page;
+}
+
+/**
+ * Draws screens that change every character through the LCD output queue of
+ * an emulated display and checks that each one is shown as it was drawn,
+ * i.e. that the bytes arrive complete and in order. The display shares the
+ * bus with an EEPROM, written while each screen is being sent.
+ *
+ * @param bus The I2C bus
+ * @return The cost of a screen update
+ */
+auto Measure_LCD_Queue(I2CBus & bus) -> LcdQueueEffort
+{
+    using clock = std::chrono::steady_clock;
+
+    static HD44780 screen {};
+    static std::atomic<size_t> bytes {0};
+
+    Host::AttachI2CDevice(i2c1, LCD_ADDRESS, [](uint8_t const * data, size_t length)
+    {
+        bytes += length;
+        return screen.Write(data, length);
+    }, [](uint8_t * data, size_t length)
+    {
+        return screen.Read(data, length);
+    });
+    Host::SetI2CDeviceSpeed(i2c1, LCD_ADDRESS, LCD_BUS_SPEED);
+    Host::AttachI2CDevice(i2c1, EEPROM_ADDRESS, [](uint8_t const * data, size_t length)
+    {
+        eeprom_address = data[0];
+        for (size_t index = 1; index < length; ++index)
+        {
+            eeprom[eeprom_address++] = data[index];
+        }
+        return true;
+    }, [](uint8_t * data, size_t length)
+    {
+        for (size_t index = 0; index < length; ++index)
+        {
+            data[index] = eeprom[eeprom_address++];
+        }
+        return true;
+    });
+
+    bus.AddDevice(LCD_ADDRESS, LCD_I2C::MAX_BUS_SPEED);
+    auto const EEPROM = bus.AddDevice(EEPROM_ADDRESS);
+    screen.SetBusSpeed(bus.Probe());
+
+    LcdQueueEffort effort {};
+    LCD_I2C lcd {&bus, LCD_ADDRESS, HD44780::COLUMNS, HD44780::ROWS};
+    lcd.WaitForIdle();
+    bytes = 0;
+    auto const BUS_TIME = screen.GetBusTime();
+
+    clock::duration enqueue {};
+    clock::duration drain {};
+    for (uint8_t round = 0; round < LCD_SCREENS; ++round)
+    {
+        std::array<std::string, HD44780::ROWS> lines {};
+        for (uint8_t row = 0; row < HD44780::ROWS; ++row)
+        {
+            for (uint8_t column = 0; column < HD44780::COLUMNS; ++column)
+            {
+                lines[row].push_back(static_cast<char>('A' + (round + row * HD44780::COLUMNS + column) % 26));
+            }
+            lcd.SetCursor(row, 0);
+            lcd.PrintString(lines[row]);
+        }
+
+        auto const START = clock::now();
+        lcd.Flush();
+        auto const QUEUED = clock::now();
+
+        auto const PAGE = Get_EEPROM_Page(round);
+        bus.Write(EEPROM, PAGE.data(), PAGE.size());
+        lcd.WaitForIdle();
+        drain += clock::now() - START;
+        enqueue += QUEUED - START;
+
+        for (uint8_t row = 0; row < HD44780::ROWS; ++row)
+        {
+            effort.mismatches += (screen.GetLine(row) != lines[row]) ? 1 : 0;
+        }
+    }
+
+    auto const MICROSECONDS = [](clock::duration duration)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    };
+    effort.screens = LCD_SCREENS;
+    effort.enqueue = static_cast<uint32_t>(MICROSECONDS(enqueue) / LCD_SCREENS);
+    effort.drain = static_cast<uint32_t>(MICROSECONDS(drain) / LCD_SCREENS);
+    effort.bytes_per_second = static_cast<uint32_t>(bytes * 1'000'000 / std::max(MICROSECONDS(drain), uint64_t {1}));
+    effort.bus = static_cast<uint32_t>((screen.GetBusTime() - BUS_TIME) / 1'000 / LCD_SCREENS);
+    effort.violations = screen.GetTimingViolations();
+    return effort;
+}
+
+/**
+ * Reads back the EEPROM pages written while drawing the screens, writes to
+ * a device that does not answer, and collects the traffic of every device.
+ *
+ * @param bus The I2C bus, after Measure_LCD_Queue()
+ * @return The traffic of the bus
+ */
+auto Measure_I2C_Bus(I2CBus & bus) noexcept -> BusEffort
+{
+    BusEffort effort {};
+    auto const EEPROM = bus.AddDevice(EEPROM_ADDRESS);
+    auto const ABSENT = bus.AddDevice(ABSENT_ADDRESS);
+
+    // Each page keeps the bytes of the last screen that wrote it
+    for (uint8_t round = LCD_SCREENS - 256 / EEPROM_PAGE_SIZE; round < LCD_SCREENS; ++round)
+    {
+        auto const PAGE = Get_EEPROM_Page(round);
+        std::array<uint8_t, EEPROM_PAGE_SIZE> stored {};
+
+        bus.Write(EEPROM, PAGE.data(), 1);
+        bus.Read(EEPROM, stored.data(), stored.size());
+        effort.mismatches += std::equal(stored.begin(), stored.end(), PAGE.begin() + 1) ? 0 : 1;
+    }
+
+    // Half the writes are blocking, the other half are queued and end in the interrupt of the controller
+    for (uint8_t write = 0; write < ABSENT_WRITES; write += 2)
+    {
+        uint8_t const VALUE = write;
+        bus.Write(ABSENT, &VALUE, 1);
+
+        static constexpr I2CBus::entry WORD = I2C_IC_DATA_CMD_STOP_BITS;
+        bus.Submit(ABSENT, &WORD, 1, [](void *) noexcept {}, nullptr);
+        bus.WaitForIdle();
+    }
+
+    effort.baud_rate = bus.GetBaudRate();
+    for (I2CBus::device handle = 0; handle < bus.GetDeviceCount(); ++handle)
+    {
+        effort.addresses[handle] = bus.GetAddress(handle);
+        effort.devices[handle] = bus.GetStatistics(handle);
+    }
+    return effort;
+}
+
+/**
+ * Counts the nodes every search visits with each move ordering.
+ *
+ * @return The nodes per move ordering
+ */
+auto Measure_Move_Orderings() noexcept -> std::array<OrderingEffort, ORDERINGS.size()>
+{
+    std::array<OrderingEffort, ORDERINGS.size()> efforts {};
+
+    for (size_t index = 0; index < ORDERINGS.size(); ++index)
+    {
+        HardStrategy hard {HardStrategy::Mode::SEARCH};
+        hard.SetOpeningBook(false);
+        hard.SetMoveOrdering(ORDERINGS[index]);
+        Benchmark::KeepAlive(hard.GetNextMove(Board {}));
+        efforts[index].hard_3x3 = hard.GetSearchStatistics().nodes;
+
+        GridSearch<5, 4> grid_5x5 {4};
+        grid_5x5.SetMoveOrdering(ORDERINGS[index]);
+        auto board_5x5 = Make_Grid_Midgame<5, 4>();
+        Benchmark::KeepAlive(grid_5x5.Search(board_5x5));
+        efforts[index].grid_5x5 = grid_5x5.GetSearchStatistics().nodes;
+
+        GridSearch<15, 5> grid_15x15 {2};
+        grid_15x15.SetMoveOrdering(ORDERINGS[index]);
+        auto board_15x15 = Make_Grid_Midgame<15, 5>();
+        Benchmark::KeepAlive(grid_15x15.Search(board_15x15));
+        efforts[index].grid_15x15 = grid_15x15.GetSearchStatistics().nodes;
+    }
+    return efforts;
+}
+
+/**
+ * Measures the move latency of a strategy from the empty board and over the
+ * mid-game corpus.
+ *
+ * @param benchmark The benchmark
+ * @param name The name of the strategy in the results
+ * @param strategy The strategy
+ * @param corpus The mid-game corpus
+ * @param before_move Called before every move, e.g. to clear a cache
+ * @param search The strategy again if it searches, to count its nodes
+ */
+template <typename Hook>
+void Measure_Strategy(Benchmark & benchmark, std::string_view name, IPlayerStrategy & strategy,
+                      std::vector<Board> const & corpus, Hook before_move, HardStrategy const * search = nullptr)
+{
+    static Board const EMPTY_BOARD {};
+
+    uint64_t nodes = 0;
+    auto const COUNT_NODES = [&]
+    {
+        if (search != nullptr)
+        {
+            nodes += search->GetSearchStatistics().nodes;
+        }
+    };
+    auto const NODE_COUNTER = (search != nullptr && SearchStatistics::ENABLED) ?
+                              Benchmark::NodeCounter {[&nodes] {return nodes;}} : Benchmark::NodeCounter {};
+
+    benchmark.Run(std::string {name} + ".empty_board", [&](uint64_t)
+    {
+        before_move();
+        Benchmark::KeepAlive(strategy.GetNextMove(EMPTY_BOARD));
+        COUNT_NODES();
+    }, NODE_COUNTER);
+
+    benchmark.Run(std::string {name} + ".midgame", [&](uint64_t iteration)
+    {
+        before_move();
+        Benchmark::KeepAlive(strategy.GetNextMove(corpus[iteration % corpus.size()]));
+        COUNT_NODES();
+    }, NODE_COUNTER);
+}
+
+/**
+ * Checks that the searches do not allocate, since the device has no heap to
+ * spare for them.
+ *
+ * @param benchmark The benchmark
+ * @return True if no search allocates
+ */
+auto Searches_Allocate_Nothing(Benchmark const & benchmark) noexcept -> bool
+{
+    static constexpr std::array<std::string_view, 3> SEARCHES {"hard_search_", "mcts.", "grid_search_"};
+
+    auto const & RESULTS = benchmark.GetResults();
+    return std::none_of(RESULTS.begin(), RESULTS.end(), [](Benchmark::Result const & result)
+    {
+        return result.allocations_per_op != 0 && std::any_of(SEARCHES.begin(), SEARCHES.end(),
+                                                             [&](std::string_view search)
+        {
+            return result.name.starts_with(search);
+        });
+    });
+}
+
+/**
+ * Prints an array of counters as a JSON array.
+ *
+ * @param counters The counters
+ */
+template <size_t SIZE>
+void Print_Counters(std::array<uint32_t, SIZE> const & counters) noexcept
+{
+    std::printf("[");
+    for (size_t index = 0; index < SIZE; ++index)
+    {
+        std::printf("%s%lu", (index == 0) ? "" : ", ", static_cast<unsigned long>(counters[index]));
+    }
+    std::printf("]");
+}
+
+/**
+ * Prints the cells of a line as a JSON array.
+ *
+ * @param line The line
+ */
+void Print_Line(HardStrategy::Line const & line) noexcept
+{
+    std::printf("[");
+    for (uint8_t index = 0; index < line.GetLength(); ++index)
+    {
+        std::printf("%s%u", (index == 0) ? "" : ", ", static_cast<unsigned>(line[index]));
+    }
+    std::printf("]");
+}
+
+/**
+ * Prints the measurements of the benchmark as the "results" JSON array.
+ *
+ * @param benchmark The benchmark
+ */
+void Print_Benchmark(Benchmark const & benchmark) noexcept
+{
+    std::printf("  \"results\": [\n");
+
+    auto const & RESULTS = benchmark.GetResults();
+    for (size_t index = 0; index < RESULTS.size(); ++index)
+    {
+        auto const & RESULT = RESULTS[index];
+
+        std::printf("    {\"name\": \"%s\", \"ns_per_op\": %.2f, \"iterations\": %llu, \"allocations_per_op\": %.3f",
+                    RESULT.name.c_str(), RESULT.ns_per_op, static_cast<unsigned long long>(RESULT.iterations),
+                    RESULT.allocations_per_op);
+        if (RESULT.nodes_per_second >= 0)
+        {
+            std::printf(", \"nodes_per_second\": %.0f", RESULT.nodes_per_second);
+        }
+        std::printf("}%s\n", (index + 1 < RESULTS.size()) ? "," : "");
+    }
+
+    std::printf("  ],\n");
+}
+
+/**
+ * Prints the effort of the searches, if the statistics are enabled.
+ *
+ * @param search The effort of a cold search from the empty board
+ * @param line The principal variation of the same search
+ * @param orderings The nodes visited with each move ordering
+ */
+void Print_Search_Effort(SearchStatistics const & search, HardStrategy::Line const & line,
+                         std::array<OrderingEffort, ORDERINGS.size()> const & orderings) noexcept
+{
+    if constexpr (SearchStatistics::ENABLED)
+    {
+        std::printf("  \"empty_board_search\": {\"nodes\": %lu, \"leaves\": %lu, \"max_depth\": %u, "
+                    "\"tt_hits\": %lu, \"tt_misses\": %lu, \"researches\": %lu,\n",
+                    static_cast<unsigned long>(search.nodes), static_cast<unsigned long>(search.leaves),
+                    static_cast<unsigned>(search.max_depth), static_cast<unsigned long>(search.tt_hits),
+                    static_cast<unsigned long>(search.tt_misses), static_cast<unsigned long>(search.researches));
+        std::printf("    \"principal_variation\": ");
+        Print_Line(line);
+        std::printf(",\n");
+        std::printf("    \"alpha_cutoffs\": ");
+        Print_Counters(search.alpha_cutoffs);
+        std::printf(",\n    \"beta_cutoffs\": ");
+        Print_Counters(search.beta_cutoffs);
+        std::printf("},\n");
+
+        std::printf("  \"move_ordering_nodes\": {\n");
+        for (size_t index = 0; index < ORDERINGS.size(); ++index)
+        {
+            std::printf("    \"%s\": {\"hard_3x3\": %lu, \"grid_5x5\": %lu, \"grid_15x15\": %lu}%s\n",
+                        ORDERING_NAMES[index], static_cast<unsigned long>(orderings[index].hard_3x3),
+                        static_cast<unsigned long>(orderings[index].grid_5x5),
+                        static_cast<unsigned long>(orderings[index].grid_15x15),
+                        (index + 1 < ORDERINGS.size()) ? "," : "");
+        }
+        std::printf("  },\n");
+    }
+}
+
+/**
+ * Prints the searches of the 15x15 board with a time budget and with lanes.
+ *
+ * @param timed The iterative deepening search with a time budget
+ * @param parallel The parallel searches with every number of lanes
+ */
+void Print_Grid_Searches(TimedSearch const & timed, std::vector<ParallelSearch> const & parallel) noexcept
+{
+    std::printf("  \"timed_search_15x15\": {\"budget_us\": %lu, \"tolerance_us\": %lu, \"depth\": %u, "
+                "\"elapsed_us\": %lu},\n",
+                static_cast<unsigned long>(TIME_BUDGET), static_cast<unsigned long>(TIME_BUDGET_TOLERANCE),
+                static_cast<unsigned>(timed.depth), static_cast<unsigned long>(timed.elapsed));
+    std::printf("  \"parallel_search_15x15\": {\"depth\": %u, \"lanes\": [\n", static_cast<unsigned>(PARALLEL_DEPTH));
+    for (size_t index = 0; index < parallel.size(); ++index)
+    {
+        auto const & SEARCH = parallel[index];
+        std::printf("    {\"lanes\": %u, \"elapsed_us\": %lu, \"speedup\": %.2f, \"same_move\": %s",
+                    static_cast<unsigned>(SEARCH.lanes), static_cast<unsigned long>(SEARCH.elapsed),
+                    static_cast<double>(parallel.front().elapsed) / static_cast<double>(SEARCH.elapsed),
+                    SEARCH.same_move ? "true" : "false");
+        if constexpr (SearchStatistics::ENABLED)
+        {
+            std::printf(", \"nodes\": %lu", static_cast<unsigned long>(SEARCH.nodes));
+        }
+        std::printf("}%s\n", (index + 1 < parallel.size()) ? "," : "");
+    }
+    std::printf("  ]},\n");
+}
+
+/**
+ * Prints the speed and strength of the Monte Carlo tree search.
+ *
+ * @param monte_carlo The effort of the search
+ */
+void Print_Monte_Carlo(MonteCarloEffort const & monte_carlo) noexcept
+{
+    std::printf("  \"mcts\": {\"playouts\": %lu, \"playouts_per_second_3x3\": %lu, "
+                "\"playouts_per_second_15x15\": %lu, \"midgame_positions\": %zu, \"mismatches_vs_table\": %zu},\n",
+                static_cast<unsigned long>(MctsStrategy::DEFAULT_PLAYOUTS),
+                static_cast<unsigned long>(monte_carlo.playouts_per_second_3x3),
+                static_cast<unsigned long>(monte_carlo.playouts_per_second_15x15), monte_carlo.positions,
+                monte_carlo.mismatches);
+}
+
+/**
+ * Prints the cost of the screen updates and the traffic of the I2C bus.
+ *
+ * @param lcd_queue The cost of a screen update through the LCD output queue
+ * @param i2c_bus The traffic of the I2C bus shared by the display
+ */
+void Print_I2C(LcdQueueEffort const & lcd_queue, BusEffort const & i2c_bus) noexcept
+{
+    std::printf("  \"lcd_queue\": {\"screens\": %zu, \"enqueue_us\": %lu, \"drain_us\": %lu, "
+                "\"bytes_per_second\": %lu, \"bus_us\": %lu, \"mismatches\": %zu, \"timing_violations\": %zu},\n",
+                lcd_queue.screens, static_cast<unsigned long>(lcd_queue.enqueue),
+                static_cast<unsigned long>(lcd_queue.drain), static_cast<unsigned long>(lcd_queue.bytes_per_second),
+                static_cast<unsigned long>(lcd_queue.bus), lcd_queue.mismatches, lcd_queue.violations);
+    std::printf("  \"i2c_bus\": {\"baud_rate\": %u, \"eeprom_mismatches\": %zu, \"devices\": [\n", i2c_bus.baud_rate,
+                i2c_bus.mismatches);
+    for (size_t index = 0; index < i2c_bus.devices.size(); ++index)
+    {
+        auto const & DEVICE = i2c_bus.devices[index];
+        std::printf("    {\"address\": \"0x%02x\", \"transfers\": %lu, \"bytes\": %llu, \"bytes_per_second\": %lu, "
+                    "\"naks\": %lu}%s\n", static_cast<unsigned>(i2c_bus.addresses[index]),
+                    static_cast<unsigned long>(DEVICE.transfers), static_cast<unsigned long long>(DEVICE.bytes),
+                    static_cast<unsigned long>(DEVICE.GetBytesPerSecond()), static_cast<unsigned long>(DEVICE.naks),
+                    (index + 1 < i2c_bus.devices.size()) ? "," : "");
+    }
+    std::printf("  ]},\n");
+}
+
+/**
+ * Prints the results as a JSON document.
+ *
+ * @param benchmark The benchmark
+ * @param results The results measured besides the benchmark
+ */
+void Print_JSON(Benchmark const & benchmark, Results const & results) noexcept
+{
+    std::printf("{\n");
+    std::printf("  \"tt_size\": %zu,\n", TranspositionTable::SIZE);
+    std::printf("  \"midgame_positions\": %zu,\n", results.corpus_size);
+    Print_Benchmark(benchmark);
+    Print_Search_Effort(results.search, results.line, results.orderings);
+    Print_Grid_Searches(results.timed, results.parallel);
+    Print_Monte_Carlo(results.monte_carlo);
+    Print_I2C(results.lcd_queue, results.i2c_bus);
+    std::printf("  \"table_vs_minimax\": {\"positions\": %zu, \"mismatches\": %zu},\n", results.checked,
+                results.table_mismatches);
+    std::printf("  \"search_vs_table\": {\"positions\": %zu, \"mismatches\": %zu},\n", results.checked,
+                results.mismatches);
+    std::printf("  \"grid_search_vs_table\": {\"positions\": %zu, \"mismatches\": %zu},\n", results.checked,
+                results.grid_mismatches);
+    std::printf("  \"parallel_grid_search_vs_table\": {\"positions\": %zu, \"lanes\": %u, \"mismatches\": %zu}\n",
+                results.checked, static_cast<unsigned>(results.parallel_lanes), results.parallel_mismatches);
+    std::printf("}\n");
+}
+
+/**
+ * Checks every result that must hold: the table agrees with minimax, the
+ * searches agree with the table and with each other, the timed search keeps to its budget, the display shows
+ * what was drawn on time, only the absent device misses acknowledges and no
+ * search allocates.
+ *
+ * @param benchmark The benchmark
+ * @param results The results measured besides the benchmark
+ * @return True if they all hold
+ */
+auto Check_Results(Benchmark const & benchmark, Results const & results) noexcept -> bool
+{
+    auto const PARALLEL_AGREES = std::all_of(results.parallel.begin(), results.parallel.end(),
+                                             [](ParallelSearch const & parallel)
+    {
+        return parallel.same_move;
+    });
+
+    // The probe must settle on the rated speed of the display, although the emulated one acknowledges faster
+    auto const & BUS = results.i2c_bus;
+    auto const BUS_AGREES = BUS.baud_rate == LCD_I2C::MAX_BUS_SPEED && BUS.mismatches == 0 &&
+                            BUS.devices[0].naks == 0 && BUS.devices[1].naks == 0 && BUS.devices[2].naks == ABSENT_WRITES;
+
+    // The timed search may only overrun its budget by the time it takes to unwind
+    auto const IN_TIME = results.timed.elapsed <= TIME_BUDGET + TIME_BUDGET_TOLERANCE;
+
+    return results.table_mismatches == 0 && results.mismatches == 0 && results.grid_mismatches == 0 &&
+           results.parallel_mismatches == 0 && IN_TIME && PARALLEL_AGREES && results.lcd_queue.mismatches == 0 &&
+           results.lcd_queue.violations == 0 && BUS_AGREES && Searches_Allocate_Nothing(benchmark);
+}
+}  // namespace
+
+int main()
+{
+    std::vector<bool> visited(BitBoard::KEY_COUNT, false);
+    std::vector<BitBoard> positions {};
+    BitBoard start {};
+    Collect_Positions(start, visited, positions);
+
+    auto const CORPUS = Make_Midgame_Corpus(positions);
+    auto * const MANAGER = BoardManager::Instance();
+    Benchmark benchmark {};
+
+    benchmark.Run("board.is_winner", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(MANAGER->IsWinner(PlayerSymbol::X, CORPUS[iteration % CORPUS.size()]));
+    });
+    benchmark.Run("board.is_terminal", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(MANAGER->IsTerminal(CORPUS[iteration % CORPUS.size()]));
+    });
+    benchmark.Run("board.get_actions", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(MANAGER->GetActions(CORPUS[iteration % CORPUS.size()]));
+    });
+    benchmark.Run("board.get_result_board", [&](uint64_t iteration)
+    {
+        auto const & BOARD = CORPUS[iteration % CORPUS.size()];
+        auto const ACTION = BitBoard::MoveFromCell(static_cast<uint8_t>(std::countr_zero(BitBoard {BOARD}.GetEmpty())));
+        Benchmark::KeepAlive(MANAGER->GetResultBoard(BOARD, ACTION, MANAGER->GetCurrentPlayer(BOARD)));
+    });
+    benchmark.Run("bitboard.is_terminal", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(positions[iteration % positions.size()].IsTerminal());
+    });
+    benchmark.Run("bitboard.canonicalise", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(BoardManager::Canonicalise(positions[iteration % positions.size()]));
+    });
+    benchmark.Run("bitboard.from_key", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(BitBoard::FromKey(static_cast<BitBoard::key>(iteration % BitBoard::KEY_COUNT)));
+    });
+    benchmark.Run("position_index.get_index", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(PositionIndex::GetIndex(positions[iteration % positions.size()]));
+    });
+    benchmark.Run("position_index.get_position", [&](uint64_t iteration)
+    {
+        Benchmark::KeepAlive(PositionIndex::GetPosition(static_cast<PositionIndex::index>(iteration % PositionIndex::POSITIONS)));
+    });
+
+    auto const GOMOKU = Make_Grid_Midgame<15, 5>();
+    benchmark.Run("grid_15x15.is_winning_move", [&](uint64_t iteration)
+    {
+        auto const CELL = static_cast<GridBoard<15, 5>::cell>(iteration % GridBoard<15, 5>::CELLS);
+        Benchmark::KeepAlive(GOMOKU.IsWinningMove(CELL, GOMOKU.GetPiece(CELL)));
+    });
+    benchmark.Run("grid_15x15.get_moves", [&](uint64_t)
+    {
+        Benchmark::KeepAlive(GOMOKU.GetMoves().GetSize());
+    });
+
+    // One incremental evaluation: the update after a move and the score
+    LineEvaluator<15, 5> evaluator {};
+    evaluator.Reset(GOMOKU);
+    auto const GOMOKU_MOVES = GOMOKU.GetMoves();
+    benchmark.Run("line_evaluator_15x15.make_move", [&](uint64_t iteration)
+    {
+        auto const CELL = GOMOKU_MOVES[static_cast<GridBoard<15, 5>::cell>(iteration % GOMOKU_MOVES.GetSize())];
+        evaluator.MakeMove(CELL, PlayerSymbol::X);
+        Benchmark::KeepAlive(evaluator.GetScore());
+        evaluator.UnmakeMove(CELL, PlayerSymbol::X);
+    });
+    benchmark.Run("line_evaluator_15x15.reset", [&](uint64_t)
+    {
+        evaluator.Reset(GOMOKU);
+        Benchmark::KeepAlive(evaluator.GetScore());
+    });
+
+    EasyStrategy easy {};
+    MediumStrategy medium {};
+    HardStrategy table {HardStrategy::Mode::TABLE};
+    HardStrategy search {HardStrategy::Mode::SEARCH};
+    HardStrategy unbooked {HardStrategy::Mode::SEARCH};
+    MctsStrategy mcts {};
+    auto & transposition_table = search.GetTranspositionTable();
+    unbooked.SetOpeningBook(false);
+
+    auto const NO_HOOK = [] {};
+
+    Measure_Strategy(benchmark, "easy", easy, CORPUS, NO_HOOK);
+    Measure_Strategy(benchmark, "medium", medium, CORPUS, NO_HOOK);
+    Measure_Strategy(benchmark, "hard_table", table, CORPUS, NO_HOOK);
+    Measure_Strategy(benchmark, "mcts", mcts, CORPUS, NO_HOOK);
+
+    // Cold: every move starts with an empty transposition table, like the
+    // first move of a game. Warm: the table is kept, like the later moves.
+    Measure_Strategy(benchmark, "hard_search_cold", search, CORPUS, [&] {transposition_table.Clear();}, &search);
+    Measure_Strategy(benchmark, "hard_search_warm", search, CORPUS, NO_HOOK, &search);
+    Measure_Strategy(benchmark, "hard_search_cold_no_book", unbooked, CORPUS,
+                     [&] {unbooked.GetTranspositionTable().Clear();}, &unbooked);
+
+    Measure_Grid_Search<4, 4>(benchmark, "grid_search_4x4", 4);
+    Measure_Grid_Search<5, 4>(benchmark, "grid_search_5x5", 3);
+    Measure_Grid_Search<15, 5>(benchmark, "grid_search_15x15", 2);
+    Measure_Grid_Search<15, 5, NullEvaluator<15, 5>>(benchmark, "grid_search_15x15_null", 2);
+
+    // The effort of a deterministic search, to catch silent growth
+    unbooked.GetTranspositionTable().Clear();
+    Benchmark::KeepAlive(unbooked.GetNextMove(Board {}));
+
+    static I2CBus bus {i2c1, 2, 3};
+    auto const PARALLEL_LANES = std::max(SearchPool::GetLaneCount(), MIN_PARALLEL_LANES);
+    Results const RESULTS {
+        .search = unbooked.GetSearchStatistics(),
+        .line = unbooked.GetPrincipalVariation(),
+        .corpus_size = CORPUS.size(),
+        .checked = positions.size(),
+        .table_mismatches = Count_Table_Mismatches(positions),
+        .mismatches = Count_Search_Mismatches(positions),
+        .grid_mismatches = Count_Grid_Search_Mismatches(positions, 1),
+        .parallel_mismatches = Count_Grid_Search_Mismatches(positions, PARALLEL_LANES),
+        .parallel_lanes = PARALLEL_LANES,
+        .timed = Run_Timed_Grid_Search(),
+        .orderings = Measure_Move_Orderings(),
+        .parallel = Measure_Parallel_Search(),
+        .monte_carlo = Measure_Monte_Carlo(CORPUS),
+        .lcd_queue = Measure_LCD_Queue(bus),
+        .i2c_bus = Measure_I2C_Bus(bus),
+    };
+    Print_JSON(benchmark, RESULTS);
+
+    return Check_Results(benchmark, RESULTS) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
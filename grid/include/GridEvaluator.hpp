@@ -0,0 +1,323 @@
+/*******************************************************************************
+ * @file GridEvaluator.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the static evaluators used by GridSearch.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "GridBoard.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <array>
+
+/**
+ * Evaluator that scores every unfinished position as a draw, so the search
+ * only knows about the wins it can see before its depth limit.
+ *
+ * Every evaluator follows the same interface: it is reset from the root
+ * position, it is told about every move made and unmade by the search, and
+ * it scores the current position from X's point of view, within MAX_SCORE.
+ *
+ * @tparam N The number of rows and columns
+ * @tparam K The number of pieces in a row needed to win
+ */
+template <uint8_t N, uint8_t K>
+class NullEvaluator final
+{
+ public:
+
+    using Board = GridBoard<N, K>;
+    using cell = typename Board::cell;
+
+    static constexpr int32_t MAX_SCORE = 0;
+
+    /**
+     * Starts tracking a position.
+     *
+     * @param current_board The position
+     */
+    constexpr void Reset(Board const & current_board) noexcept;
+
+    /**
+     * Updates the score after a move.
+     *
+     * @param target The cell of the move
+     * @param player The player who made the move
+     */
+    constexpr void MakeMove(cell target, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Updates the score after a move is taken back.
+     *
+     * @param target The cell of the move
+     * @param player The player who made the move
+     */
+    constexpr void UnmakeMove(cell target, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Gets the score of the current position.
+     *
+     * @return The score from X's point of view
+     */
+    [[nodiscard]] constexpr auto GetScore() const noexcept -> int32_t;
+};
+
+/**
+ * Evaluator that counts the open lines of every player: each window of K
+ * cells in a row, column or diagonal that holds the pieces of only one
+ * player is worth more the more pieces it holds, so a window one piece away
+ * from K in a row (a threat) outweighs many weaker ones. A cell in the centre
+ * belongs to more windows than one near the edges, which rewards centre
+ * control on its own. The per-window piece counts are kept up to date on
+ * every move, so an update only visits the at most 4K windows through the
+ * cell of the move.
+ *
+ * @tparam N The number of rows and columns
+ * @tparam K The number of pieces in a row needed to win
+ */
+template <uint8_t N, uint8_t K>
+class LineEvaluator final
+{
+ public:
+
+    using Board = GridBoard<N, K>;
+    using cell = typename Board::cell;
+
+    /**
+     * Number of windows of K cells on the board.
+     */
+    static constexpr uint16_t WINDOWS = 2 * N * (N - K + 1) + 2 * (N - K + 1) * (N - K + 1);
+
+    static constexpr int32_t MAX_SCORE = 500'000;
+
+ private:
+
+    using window = uint16_t;
+
+    /**
+     * The windows that contain every cell.
+     */
+    struct CellWindows
+    {
+        std::array<std::array<window, 4 * K>, Board::CELLS> windows {};
+        std::array<uint8_t, Board::CELLS> count {};
+    };
+
+    /**
+     * Builds the windows that contain every cell.
+     *
+     * @return The windows of every cell
+     */
+    [[nodiscard]] static constexpr auto Make_Cell_Windows() noexcept -> CellWindows;
+
+    /**
+     * Builds the worth of a window for every number of pieces in it, growing
+     * eightfold with every piece but never letting the total go past
+     * MAX_SCORE.
+     *
+     * @return The weights
+     */
+    [[nodiscard]] static constexpr auto Make_Weights() noexcept -> std::array<int32_t, K + 1>;
+
+    static constexpr CellWindows CELL_WINDOWS = Make_Cell_Windows();
+    static constexpr std::array<int32_t, K + 1> WEIGHTS = Make_Weights();
+
+    static_assert(WINDOWS * WEIGHTS[K] <= MAX_SCORE, "The score must stay within its bounds");
+
+    std::array<std::array<uint8_t, 2>, WINDOWS> counts {};
+    int32_t score {0};
+
+    /**
+     * Gets the worth of a window from X's point of view.
+     *
+     * @param target The window
+     * @return The worth
+     */
+    [[nodiscard]] constexpr auto Get_Window_Score(window target) const noexcept -> int32_t;
+
+    /**
+     * Adds or removes a piece from the windows through a cell.
+     *
+     * @param target The cell
+     * @param player The player who owns the piece
+     * @param change 1 to add the piece, -1 to remove it
+     */
+    constexpr void Update(cell target, Utility::PlayerSymbol player, int8_t change) noexcept;
+
+ public:
+
+    /**
+     * Starts tracking a position.
+     *
+     * @param current_board The position
+     */
+    constexpr void Reset(Board const & current_board) noexcept;
+
+    /**
+     * Updates the score after a move.
+     *
+     * @param target The cell of the move
+     * @param player The player who made the move
+     */
+    constexpr void MakeMove(cell target, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Updates the score after a move is taken back.
+     *
+     * @param target The cell of the move
+     * @param player The player who made the move
+     */
+    constexpr void UnmakeMove(cell target, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Gets the score of the current position.
+     *
+     * @return The score from X's point of view
+     */
+    [[nodiscard]] constexpr auto GetScore() const noexcept -> int32_t;
+};
+
+template <uint8_t N, uint8_t K>
+constexpr void NullEvaluator<N, K>::Reset(Board const &) noexcept {}
+
+template <uint8_t N, uint8_t K>
+constexpr void NullEvaluator<N, K>::MakeMove(cell, Utility::PlayerSymbol) noexcept {}
+
+template <uint8_t N, uint8_t K>
+constexpr void NullEvaluator<N, K>::UnmakeMove(cell, Utility::PlayerSymbol) noexcept {}
+
+template <uint8_t N, uint8_t K>
+constexpr auto NullEvaluator<N, K>::GetScore() const noexcept -> int32_t
+{
+    return 0;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto LineEvaluator<N, K>::Make_Cell_Windows() noexcept -> CellWindows
+{
+    CellWindows cell_windows {};
+    window next_window = 0;
+
+    for (auto const & [ROW_STEP, COLUMN_STEP]: Board::DIRECTIONS)
+    {
+        for (int row = 0; row < N; ++row)
+        {
+            for (int column = 0; column < N; ++column)
+            {
+                auto const LAST_ROW = row + (K - 1) * ROW_STEP;
+                auto const LAST_COLUMN = column + (K - 1) * COLUMN_STEP;
+                if (LAST_ROW < 0 || LAST_ROW >= N || LAST_COLUMN < 0 || LAST_COLUMN >= N)
+                {
+                    continue;
+                }
+
+                for (int index = 0; index < K; ++index)
+                {
+                    auto const CELL = Board::GetCell(static_cast<uint8_t>(row + index * ROW_STEP),
+                                                     static_cast<uint8_t>(column + index * COLUMN_STEP));
+                    cell_windows.windows[CELL][cell_windows.count[CELL]++] = next_window;
+                }
+                ++next_window;
+            }
+        }
+    }
+    return cell_windows;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto LineEvaluator<N, K>::Make_Weights() noexcept -> std::array<int32_t, K + 1>
+{
+    constexpr int32_t GROWTH = 8;
+    constexpr int32_t MAX_WEIGHT = MAX_SCORE / WINDOWS;
+
+    std::array<int32_t, K + 1> weights {};
+    int32_t weight = 1;
+
+    for (uint8_t pieces = 1; pieces <= K; ++pieces)
+    {
+        weights[pieces] = std::min(weight, MAX_WEIGHT);
+        weight = std::min(weight * GROWTH, MAX_WEIGHT);
+    }
+    return weights;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto LineEvaluator<N, K>::Get_Window_Score(window target) const noexcept -> int32_t
+{
+    auto const [X_PIECES, O_PIECES] = counts[target];
+
+    if (O_PIECES == 0)
+    {
+        return WEIGHTS[X_PIECES];
+    }
+    if (X_PIECES == 0)
+    {
+        return -WEIGHTS[O_PIECES];
+    }
+    return 0;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr void LineEvaluator<N, K>::Update(cell target, Utility::PlayerSymbol player, int8_t change) noexcept
+{
+    auto const PLAYER_INDEX = (player == Utility::PlayerSymbol::X) ? 0 : 1;
+
+    for (uint8_t index = 0; index < CELL_WINDOWS.count[target]; ++index)
+    {
+        auto const WINDOW = CELL_WINDOWS.windows[target][index];
+
+        score -= Get_Window_Score(WINDOW);
+        counts[WINDOW][PLAYER_INDEX] = static_cast<uint8_t>(counts[WINDOW][PLAYER_INDEX] + change);
+        score += Get_Window_Score(WINDOW);
+    }
+}
+
+template <uint8_t N, uint8_t K>
+constexpr void LineEvaluator<N, K>::Reset(Board const & current_board) noexcept
+{
+    counts = {};
+    score = 0;
+
+    for (cell target = 0; target < Board::CELLS; ++target)
+    {
+        if (auto const PIECE = current_board.GetPiece(target); PIECE != Utility::PlayerSymbol::UNK)
+        {
+            Update(target, PIECE, 1);
+        }
+    }
+}
+
+template <uint8_t N, uint8_t K>
+constexpr void LineEvaluator<N, K>::MakeMove(cell target, Utility::PlayerSymbol player) noexcept
+{
+    Update(target, player, 1);
+}
+
+template <uint8_t N, uint8_t K>
+constexpr void LineEvaluator<N, K>::UnmakeMove(cell target, Utility::PlayerSymbol player) noexcept
+{
+    Update(target, player, -1);
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto LineEvaluator<N, K>::GetScore() const noexcept -> int32_t
+{
+    return score;
+}
+
+// A lone piece is worth more in the centre than in a corner, and more in a corner than on an edge
+static_assert([]
+{
+    auto const SCORE = [](uint8_t row, uint8_t column)
+    {
+        LineEvaluator<3, 3> evaluator {};
+        evaluator.MakeMove(GridBoard<3, 3>::GetCell(row, column), Utility::PlayerSymbol::X);
+        return evaluator.GetScore();
+    };
+    return SCORE(1, 1) > SCORE(0, 0) && SCORE(0, 0) > SCORE(0, 1);
+}(), "The open lines must reward the centre");
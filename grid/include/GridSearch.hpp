@@ -0,0 +1,909 @@
+/*******************************************************************************
+ * @file GridSearch.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the GridSearch class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <pico/time.h>
+
+#include "SharedTranspositionTable.hpp"
+#include "PrincipalVariation.hpp"
+#include "SearchStatistics.hpp"
+#include "GridEvaluator.hpp"
+#include "MoveOrdering.hpp"
+#include "SearchPool.hpp"
+#include "GridBoard.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <span>
+
+#ifndef TIC_TAC_TOE_GRID_TT_SIZE
+#define TIC_TAC_TOE_GRID_TT_SIZE 65536
+#endif
+
+/**
+ * Depth-limited negamax alpha–beta search for the boards of any size. The 3x3 game
+ * keeps its own search in HardStrategy, which relies on the symmetries and
+ * the transposition table of that board; this one only needs the board
+ * itself, so it scales to 15x15 as long as the depth is limited. Positions
+ * cut off by the depth limit are scored by a static evaluator, which is kept
+ * up to date move by move alongside the board.
+ *
+ * With a time budget, the search deepens one ply at a time and returns the
+ * best move of the last iteration that finished in time. The clock is only
+ * read every few nodes, so checking it stays cheap: the number of nodes
+ * between two reads follows the measured node rate, so that they are about
+ * TIME_CHECK_PERIOD apart on any build or core, and the search stops one
+ * period before the deadline, which leaves the time to unwind. The best move
+ * of every iteration is searched first by the next one.
+ *
+ * The moves of every position are ordered by the selected MoveOrdering
+ * heuristics, which only changes how much of the tree is pruned, never the
+ * score found. Unlike HardStrategy, it does not use null-window re-searches:
+ * without a transposition table to remember them, the re-searches of the
+ * evaluated positions cost more nodes than the null windows save.
+ *
+ * The root moves can be shared with helper searches, one per lane of the
+ * SearchPool (Young Brothers Wait at the root): the first move is searched
+ * alone, then the lanes take the other ones from a shared counter and search
+ * them against the best score found by any lane so far. Positions found by
+ * one lane are given to the others by a shared transposition table, which is
+ * only used for entries searched to exactly the same depth, so the chosen
+ * move is always the one a single lane would choose.
+ *
+ * @tparam N The number of rows and columns
+ * @tparam K The number of pieces in a row needed to win
+ * @tparam Evaluator The static evaluator, e.g. LineEvaluator or NullEvaluator
+ */
+template <uint8_t N, uint8_t K, typename Evaluator = LineEvaluator<N, K>>
+class GridSearch final
+{
+ public:
+
+    using Board = GridBoard<N, K>;
+    using Statistics = BasicSearchStatistics<Board::CELLS + 1>;
+    using Line = PrincipalVariation<Board::CELLS>;
+    using Table = SharedTranspositionTable<TIC_TAC_TOE_GRID_TT_SIZE>;
+    using cell = typename Board::cell;
+    using value = int32_t;
+
+    /**
+     * Score of a win at the root. Wins found deeper are worth one less per
+     * ply, so the fastest win and the slowest loss are preferred.
+     */
+    static constexpr value WIN_VALUE = 1'000'000;
+
+    /**
+     * Depth limit that lets the search reach the end of every game.
+     */
+    static constexpr uint8_t UNLIMITED_DEPTH = Board::CELLS;
+
+    /**
+     * Time budget that lets the search run until the depth limit.
+     */
+    static constexpr uint32_t UNLIMITED_TIME = 0;
+
+    /**
+     * Time between two reads of the clock in microseconds, and the margin
+     * kept before the deadline.
+     */
+    static constexpr uint32_t TIME_CHECK_PERIOD = 100;
+
+    /**
+     * Best move found by a search.
+     */
+    struct Result
+    {
+        cell move {Board::CELLS}; /* The best cell, or CELLS if the game is over */
+        value score {0};          /* The score of the move from X's point of view */
+        uint8_t depth {0};        /* The depth of the search that found the move */
+    };
+
+ private:
+
+    static constexpr value VALUE_MIN = -WIN_VALUE - 1;
+    static constexpr value VALUE_MAX = WIN_VALUE + 1;
+
+    static constexpr uint64_t NO_DEADLINE = UINT64_MAX;
+
+    /**
+     * Bounds of the number of nodes visited between two reads of the clock.
+     */
+    static constexpr uint32_t MIN_CHECK_INTERVAL = 16;
+    static constexpr uint32_t MAX_CHECK_INTERVAL = 65'536;
+
+    using Orderer = MoveOrderer<Board::CELLS, Board::CELLS + 1>;
+    using Picker = MovePicker<Board::CELLS>;
+
+    /**
+     * The static priority of every cell: the number of lines through it.
+     */
+    static constexpr auto PRIORITIES = []
+    {
+        std::array<uint8_t, Board::CELLS> priorities {};
+        for (cell target = 0; target < Board::CELLS; ++target)
+        {
+            priorities[target] = Board::GetLineCount(target);
+        }
+        return priorities;
+    }();
+
+    static_assert(Evaluator::MAX_SCORE < WIN_VALUE - Board::CELLS, "A win must be worth more than any evaluation");
+
+    uint8_t depth_limit;
+    uint32_t time_budget {UNLIMITED_TIME};
+
+    Evaluator evaluator {};
+    Orderer orderer {MoveOrdering::HISTORY};
+
+    uint64_t deadline {NO_DEADLINE};
+    uint64_t last_check {0};                      /* Time of the last read of the clock */
+    uint32_t node_count {0};                      /* Nodes visited since the last read of the clock */
+    uint32_t check_interval {MIN_CHECK_INTERVAL}; /* Nodes visited between two reads of the clock */
+    bool out_of_time {false};
+
+    Statistics statistics {};
+    Line principal_variation {};
+    cell root_move_count {0};
+
+    Table * table {nullptr};
+    std::span<GridSearch> helpers {};
+
+    value lane_score {VALUE_MIN};
+    uint32_t lane_index {0};
+    Line lane_line {};
+
+    /**
+     * Counts a visited node and the deepest ply reached. It does nothing if
+     * the statistics are disabled.
+     *
+     * @param current_board The visited position
+     */
+    void Count_Node(Board const & current_board) noexcept;
+
+    /**
+     * Computes the distance of a position from the root of the search.
+     *
+     * @param current_board The position
+     * @return The ply
+     */
+    [[nodiscard]] auto Get_Ply(Board const & current_board) const noexcept -> uint8_t;
+
+    /**
+     * Starts counting the nodes between two reads of the clock.
+     *
+     * @param now The current time in microseconds
+     */
+    void Start_Clock(uint64_t now) noexcept;
+
+    /**
+     * Checks if the deadline is less than TIME_CHECK_PERIOD away, reading the
+     * clock only every check_interval calls and scaling the interval so that
+     * the reads are TIME_CHECK_PERIOD apart. Once it is, the search unwinds.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] auto Is_Out_Of_Time() noexcept -> bool;
+
+    /**
+     * Counts a cutoff at the ply of a position. It does nothing if the
+     * statistics are disabled.
+     *
+     * @param current_board The position
+     * @param player The player to move
+     */
+    void Count_Cutoff(Board const & current_board, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Orders the moves of a position, with the winning and blocking moves
+     * first if the ordering allows it.
+     *
+     * @param current_board The position
+     * @param player The player to move
+     * @return The moves, ready to be handed out in order
+     */
+    [[nodiscard]] auto Order_Moves(Board const & current_board, Utility::PlayerSymbol player) const noexcept -> Picker;
+
+    /**
+     * Makes a move on the board and tells the evaluator about it.
+     *
+     * @param current_board The board
+     * @param target The cell of the move
+     * @param player The player making the move
+     */
+    void Make_Move(Board & current_board, cell target, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Takes a move back on the board and tells the evaluator about it.
+     *
+     * @param current_board The board
+     * @param target The cell of the move
+     * @param player The player who made the move
+     */
+    void Unmake_Move(Board & current_board, cell target, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Scores a position where the game might be over. Only the last move can
+     * have ended it, so only its lines are checked.
+     *
+     * @param current_board The position
+     * @param last_move The cell of the last move
+     * @param score The score if the game is over, from the point of view of
+     *              the player to move
+     * @return True if the game is over
+     */
+    [[nodiscard]] auto Is_Terminal(Board const & current_board, cell last_move, value & score) noexcept -> bool;
+
+    /**
+     * Helper function to get the score of a position from the point of view
+     * of the player to move. The moves are made and unmade in place, so the
+     * board is left unchanged when the function returns.
+     *
+     * @param current_board The board to be analysed
+     * @param last_move The cell of the move that led to the position
+     * @param depth The number of plies left to search
+     * @param alpha The alpha parameter
+     * @param beta The beta parameter
+     * @param line The best line from the position, if the score is within the window
+     * @return The score
+     */
+    [[nodiscard]] auto Get_Value(Board & current_board, cell last_move, uint8_t depth, value alpha, value beta,
+                                 Line & line) noexcept -> value;
+
+    /**
+     * Helper function to search every root move to a fixed depth.
+     *
+     * @param current_board The board to be analysed
+     * @param moves The root moves, in the order they are searched
+     * @param depth The number of plies searched below the root
+     * @param line The best line from the root
+     * @return The best move, only valid if the search was not out of time
+     */
+    [[nodiscard]] auto Search_Root(Board & current_board, typename Board::CellList const & moves, uint8_t depth,
+                                   Line & line) noexcept -> Result;
+
+    /**
+     * Helper function to search every root move to a fixed depth, sharing the
+     * moves after the first one with the helpers.
+     *
+     * @param current_board The board to be analysed
+     * @param moves The root moves, in the order they are searched
+     * @param depth The number of plies searched below the root
+     * @param line The best line from the root
+     * @return The best move, only valid if the search was not out of time
+     */
+    [[nodiscard]] auto Search_Root_Parallel(Board & current_board, typename Board::CellList const & moves,
+                                            uint8_t depth, Line & line) noexcept -> Result;
+
+    /**
+     * Searches the root moves handed out by a shared counter until there are
+     * none left. The best of them is kept in the lane result.
+     *
+     * @param current_board The board to be analysed, owned by the lane
+     * @param moves The root moves, in the order they are searched
+     * @param depth The number of plies searched below the root moves
+     * @param next_move The index of the next root move to be searched
+     * @param best_score The best score found by any lane so far
+     */
+    void Search_Lane(Board & current_board, typename Board::CellList const & moves, uint8_t depth,
+                     std::atomic<uint32_t> & next_move, std::atomic<value> & best_score) noexcept;
+
+ public:
+
+    /**
+     * [Constructor]
+     *
+     * @param depth_limit The number of plies searched below the root
+     */
+    explicit GridSearch(uint8_t depth_limit = UNLIMITED_DEPTH) noexcept;
+
+    /**
+     * Sets the number of plies searched below the root.
+     *
+     * @param new_depth_limit The depth limit
+     */
+    void SetDepthLimit(uint8_t new_depth_limit) noexcept;
+
+    /**
+     * Gets the number of plies searched below the root.
+     *
+     * @return The depth limit
+     */
+    [[nodiscard]] auto GetDepthLimit() const noexcept -> uint8_t;
+
+    /**
+     * Sets the time a search may take. The first iteration always finishes,
+     * so a move is found even with a tiny budget.
+     *
+     * @param microseconds The time budget, or UNLIMITED_TIME
+     */
+    void SetTimeBudget(uint32_t microseconds) noexcept;
+
+    /**
+     * Gets the time a search may take.
+     *
+     * @return The time budget in microseconds
+     */
+    [[nodiscard]] auto GetTimeBudget() const noexcept -> uint32_t;
+
+    /**
+     * Sets the heuristics used to order the moves.
+     *
+     * @param new_ordering The move ordering
+     */
+    void SetMoveOrdering(MoveOrdering new_ordering) noexcept;
+
+    /**
+     * Gets the heuristics used to order the moves.
+     *
+     * @return The move ordering
+     */
+    [[nodiscard]] auto GetMoveOrdering() const noexcept -> MoveOrdering;
+
+    /**
+     * Sets the transposition table used by the search and its helpers. It is
+     * cleared at the start of every search.
+     *
+     * @param new_table The table, or nullptr to search without one
+     */
+    void SetTranspositionTable(Table * new_table) noexcept;
+
+    /**
+     * Sets the searches that share the root moves, each on its own lane. They
+     * take the settings of this search and must not be used meanwhile.
+     *
+     * @param new_helpers The helpers, at most SearchPool::MAX_LANES - 1
+     */
+    void SetHelpers(std::span<GridSearch> new_helpers) noexcept;
+
+    /**
+     * Finds the best move for the player to move, to the depth limit or by
+     * iterative deepening within the time budget. The first of the equally
+     * good moves is returned, so the result is deterministic.
+     *
+     * @param current_board The board to be analysed, left unchanged
+     * @return The best move and its score
+     */
+    [[nodiscard]] auto Search(Board & current_board) noexcept -> Result;
+
+    /**
+     * Gets the effort spent by the last search, including its helpers.
+     * Everything is 0 unless the statistics are enabled at build time.
+     *
+     * @return The statistics
+     */
+    [[nodiscard]] auto GetSearchStatistics() const noexcept -> Statistics const &;
+
+    /**
+     * Gets the line of best play found by the last search, starting with its
+     * best move. It ends at the depth of the search or earlier.
+     *
+     * @return The principal variation
+     */
+    [[nodiscard]] auto GetPrincipalVariation() const noexcept -> Line const &;
+};
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+GridSearch<N, K, Evaluator>::GridSearch(uint8_t depth_limit) noexcept : depth_limit(depth_limit) {}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::Count_Node(Board const & current_board) noexcept
+{
+    if constexpr (Statistics::ENABLED)
+    {
+        ++statistics.nodes;
+        statistics.max_depth = std::max(statistics.max_depth, Get_Ply(current_board));
+    }
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Get_Ply(Board const & current_board) const noexcept -> uint8_t
+{
+    return static_cast<uint8_t>(current_board.GetMoveCount() - root_move_count);
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::Start_Clock(uint64_t now) noexcept
+{
+    last_check = now;
+    node_count = 0;
+    check_interval = MIN_CHECK_INTERVAL;
+    out_of_time = false;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Is_Out_Of_Time() noexcept -> bool
+{
+    if (out_of_time || ++node_count < check_interval)
+    {
+        return out_of_time;
+    }
+
+    auto const NOW = time_us_64();
+    out_of_time = deadline != NO_DEADLINE && NOW + TIME_CHECK_PERIOD >= deadline;
+
+    // The interval follows the node rate, at most doubling at a time
+    auto const ELAPSED = std::max<uint64_t>(NOW - last_check, 1);
+    auto const INTERVAL = std::min<uint64_t>(uint64_t {check_interval} * TIME_CHECK_PERIOD / ELAPSED,
+                                             uint64_t {check_interval} * 2);
+    check_interval = static_cast<uint32_t>(std::clamp<uint64_t>(INTERVAL, MIN_CHECK_INTERVAL, MAX_CHECK_INTERVAL));
+    last_check = NOW;
+    node_count = 0;
+    return out_of_time;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::Count_Cutoff(Board const & current_board, Utility::PlayerSymbol player) noexcept
+{
+    if constexpr (Statistics::ENABLED)
+    {
+        auto & cutoffs = (player == Utility::PlayerSymbol::X) ? statistics.beta_cutoffs : statistics.alpha_cutoffs;
+        ++cutoffs[Get_Ply(current_board)];
+    }
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Order_Moves(Board const & current_board,
+                                              Utility::PlayerSymbol player) const noexcept -> Picker
+{
+    auto const OPPONENT = (player == Utility::PlayerSymbol::X) ? Utility::PlayerSymbol::O : Utility::PlayerSymbol::X;
+    auto const PLY = Get_Ply(current_board);
+    auto const ORDERED = orderer.GetOrdering() != MoveOrdering::NONE;
+
+    // Nobody can complete a line before having K - 1 pieces, which skips the
+    // checks below for most of the opening
+    auto const CAN_WIN = ORDERED && current_board.GetPieceCount(player) >= K - 1;
+    auto const CAN_BLOCK = ORDERED && current_board.GetPieceCount(OPPONENT) >= K - 1;
+
+    Picker picker {};
+    for (auto const CELL: current_board.GetMoves())
+    {
+        auto tactic = Orderer::Tactic::QUIET;
+        if (CAN_WIN && current_board.IsWinningMove(CELL, player))
+        {
+            tactic = Orderer::Tactic::WIN;
+        }
+        else if (CAN_BLOCK && current_board.IsWinningMove(CELL, OPPONENT))
+        {
+            tactic = Orderer::Tactic::BLOCK;
+        }
+        picker.Add(CELL, orderer.Score(CELL, PLY, player, tactic, PRIORITIES[CELL]));
+    }
+    return picker;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::Make_Move(Board & current_board, cell target, Utility::PlayerSymbol player) noexcept
+{
+    current_board.MakeMove(target, player);
+    evaluator.MakeMove(target, player);
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::Unmake_Move(Board & current_board, cell target,
+                                              Utility::PlayerSymbol player) noexcept
+{
+    current_board.UnmakeMove(target);
+    evaluator.UnmakeMove(target, player);
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Is_Terminal(Board const & current_board, cell last_move,
+                                              value & score) noexcept -> bool
+{
+    auto const LAST_PLAYER = (current_board.GetCurrentPlayer() == Utility::PlayerSymbol::X) ?
+                             Utility::PlayerSymbol::O : Utility::PlayerSymbol::X;
+
+    if (current_board.IsWinningMove(last_move, LAST_PLAYER))
+    {
+        // The player to move has lost
+        score = static_cast<value>(Get_Ply(current_board) - WIN_VALUE);
+    }
+    else if (current_board.IsFull())
+    {
+        score = 0;
+    }
+    else
+    {
+        return false;
+    }
+
+    if constexpr (Statistics::ENABLED)
+    {
+        ++statistics.leaves;
+    }
+    return true;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Get_Value(Board & current_board, cell last_move, uint8_t depth, value alpha,
+                                            value beta, Line & line) noexcept -> value
+{
+    Count_Node(current_board);
+    line.Clear();
+
+    if (Is_Out_Of_Time())
+    {
+        return 0;
+    }
+    if (value terminal_value = 0; Is_Terminal(current_board, last_move, terminal_value))
+    {
+        return terminal_value;
+    }
+
+    auto const PLAYER = current_board.GetCurrentPlayer();
+
+    if (depth == 0)
+    {
+        return (PLAYER == Utility::PlayerSymbol::X) ? evaluator.GetScore() : -evaluator.GetScore();
+    }
+
+    auto const INITIAL_ALPHA = alpha;
+
+    if (table != nullptr)
+    {
+        auto const ENTRY = table->Probe(current_board.GetHash());
+        auto const USABLE = ENTRY && ENTRY->depth == depth &&
+                            (ENTRY->bound == Table::Bound::EXACT ||
+                             (ENTRY->bound == Table::Bound::LOWER && ENTRY->score >= beta) ||
+                             (ENTRY->bound == Table::Bound::UPPER && ENTRY->score <= alpha));
+        if constexpr (Statistics::ENABLED)
+        {
+            ++(USABLE ? statistics.tt_hits : statistics.tt_misses);
+        }
+        if (USABLE)
+        {
+            return ENTRY->score;
+        }
+    }
+
+    value best_value = VALUE_MIN;
+    Line child_line {};
+
+    auto picker = Order_Moves(current_board, PLAYER);
+    for (cell move = 0; picker.Next(move);)
+    {
+        Make_Move(current_board, move, PLAYER);
+        auto const SCORE = -Get_Value(current_board, move, depth - 1, -beta, -alpha, child_line);
+        Unmake_Move(current_board, move, PLAYER);
+
+        if (SCORE > best_value)
+        {
+            best_value = SCORE;
+            line.Set(move, child_line);
+        }
+
+        alpha = std::max(alpha, SCORE);
+        if (SCORE >= beta)
+        {
+            Count_Cutoff(current_board, PLAYER);
+            orderer.RecordCutoff(move, Get_Ply(current_board), PLAYER, depth);
+            break;
+        }
+    }
+
+    // A search cut short by the deadline did not find the real score
+    if (table != nullptr && !out_of_time)
+    {
+        table->Store(current_board.GetHash(), {best_value, depth, Table::GetBound(best_value, INITIAL_ALPHA, beta)});
+    }
+    return best_value;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::SetDepthLimit(uint8_t new_depth_limit) noexcept
+{
+    depth_limit = new_depth_limit;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::GetDepthLimit() const noexcept -> uint8_t
+{
+    return depth_limit;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::SetTimeBudget(uint32_t microseconds) noexcept
+{
+    time_budget = microseconds;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::GetTimeBudget() const noexcept -> uint32_t
+{
+    return time_budget;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::SetMoveOrdering(MoveOrdering new_ordering) noexcept
+{
+    orderer.SetOrdering(new_ordering);
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::GetMoveOrdering() const noexcept -> MoveOrdering
+{
+    return orderer.GetOrdering();
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::SetTranspositionTable(Table * new_table) noexcept
+{
+    table = new_table;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::SetHelpers(std::span<GridSearch> new_helpers) noexcept
+{
+    helpers = new_helpers.first(std::min<size_t>(new_helpers.size(), SearchPool::MAX_LANES - 1));
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Search_Root(Board & current_board, typename Board::CellList const & moves,
+                                              uint8_t depth, Line & line) noexcept -> Result
+{
+    if (!helpers.empty() && moves.GetSize() > 1)
+    {
+        return Search_Root_Parallel(current_board, moves, depth, line);
+    }
+
+    Count_Node(current_board);
+    line.Clear();
+
+    auto const PLAYER = current_board.GetCurrentPlayer();
+    auto const CHILD_DEPTH = static_cast<uint8_t>(std::max(depth, uint8_t {1}) - 1);
+
+    Result result {Board::CELLS, VALUE_MIN, depth};
+    Line child_line {};
+
+    for (auto const CELL: moves)
+    {
+        // Only a strictly better move replaces the best one, so the first of
+        // the equally good moves is kept
+        Make_Move(current_board, CELL, PLAYER);
+        auto const SCORE = -Get_Value(current_board, CELL, CHILD_DEPTH, -VALUE_MAX, -result.score, child_line);
+        Unmake_Move(current_board, CELL, PLAYER);
+
+        if (out_of_time)
+        {
+            break;
+        }
+        if (SCORE > result.score)
+        {
+            result = {CELL, SCORE, depth};
+            line.Set(CELL, child_line);
+        }
+    }
+
+    if (PLAYER == Utility::PlayerSymbol::O)
+    {
+        result.score = -result.score;
+    }
+    return result;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Search_Root_Parallel(Board & current_board, typename Board::CellList const & moves,
+                                                       uint8_t depth, Line & line) noexcept -> Result
+{
+    Count_Node(current_board);
+    line.Clear();
+
+    auto const PLAYER = current_board.GetCurrentPlayer();
+    auto const CHILD_DEPTH = static_cast<uint8_t>(std::max(depth, uint8_t {1}) - 1);
+
+    Result result {Board::CELLS, VALUE_MIN, depth};
+    Line child_line {};
+
+    // The first move is the best one of the last iteration, so its score
+    // prunes the most when the other moves are searched
+    Make_Move(current_board, moves[0], PLAYER);
+    auto const FIRST_SCORE = -Get_Value(current_board, moves[0], CHILD_DEPTH, -VALUE_MAX, -VALUE_MIN, child_line);
+    Unmake_Move(current_board, moves[0], PLAYER);
+
+    if (out_of_time)
+    {
+        return result;
+    }
+    result = {moves[0], FIRST_SCORE, depth};
+    line.Set(moves[0], child_line);
+
+    // Every lane copies the root, since the first lane searches the board
+    // of the caller in place
+    auto const ROOT = current_board;
+    for (auto & helper: helpers)
+    {
+        helper.evaluator = evaluator;
+        helper.deadline = deadline;
+        helper.Start_Clock(time_us_64());
+    }
+
+    std::atomic<uint32_t> next_move {1};
+    std::atomic<value> best_score {FIRST_SCORE};
+    auto lane_search = [&](uint8_t lane)
+    {
+        if (lane == 0)
+        {
+            Search_Lane(current_board, moves, CHILD_DEPTH, next_move, best_score);
+            return;
+        }
+        auto board = ROOT;
+        helpers[lane - 1].Search_Lane(board, moves, CHILD_DEPTH, next_move, best_score);
+    };
+    SearchPool::Run(static_cast<uint8_t>(helpers.size() + 1), lane_search);
+
+    // Every lane kept the first of its best moves, so the first of the best
+    // moves of all the lanes is the one a single lane would have chosen
+    uint32_t best_index = 0;
+    auto const MERGE = [&](GridSearch const & lane)
+    {
+        out_of_time = out_of_time || lane.out_of_time;
+        if (lane.lane_score > result.score || (lane.lane_score == result.score && lane.lane_index < best_index))
+        {
+            result = {moves[static_cast<cell>(lane.lane_index)], lane.lane_score, depth};
+            best_index = lane.lane_index;
+            line = lane.lane_line;
+        }
+    };
+    MERGE(*this);
+    for (auto const & HELPER: helpers)
+    {
+        MERGE(HELPER);
+    }
+
+    if (PLAYER == Utility::PlayerSymbol::O)
+    {
+        result.score = -result.score;
+    }
+    return result;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+void GridSearch<N, K, Evaluator>::Search_Lane(Board & current_board, typename Board::CellList const & moves,
+                                              uint8_t depth, std::atomic<uint32_t> & next_move,
+                                              std::atomic<value> & best_score) noexcept
+{
+    auto const PLAYER = current_board.GetCurrentPlayer();
+
+    lane_score = VALUE_MIN;
+    lane_index = Board::CELLS;
+    Line child_line {};
+
+    for (auto index = next_move.fetch_add(1, std::memory_order_relaxed); index < moves.GetSize();
+         index = next_move.fetch_add(1, std::memory_order_relaxed))
+    {
+        // A move as good as the best one must still get its exact score, so
+        // that the first of the equally good moves can be told apart
+        auto const ALPHA = best_score.load(std::memory_order_relaxed) - 1;
+        auto const CELL = moves[static_cast<cell>(index)];
+
+        Make_Move(current_board, CELL, PLAYER);
+        auto const SCORE = -Get_Value(current_board, CELL, depth, -VALUE_MAX, -ALPHA, child_line);
+        Unmake_Move(current_board, CELL, PLAYER);
+
+        if (out_of_time)
+        {
+            break;
+        }
+        if (SCORE > ALPHA && SCORE > lane_score)
+        {
+            lane_score = SCORE;
+            lane_index = index;
+            lane_line.Set(CELL, child_line);
+
+            auto best = best_score.load(std::memory_order_relaxed);
+            while (SCORE > best && !best_score.compare_exchange_weak(best, SCORE, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::Search(Board & current_board) noexcept -> Result
+{
+    auto const START = time_us_64();
+
+    if constexpr (Statistics::ENABLED)
+    {
+        statistics = {};
+    }
+    root_move_count = current_board.GetMoveCount();
+    principal_variation.Clear();
+    Start_Clock(START);
+
+    Result result {};
+
+    if (current_board.IsFull() || current_board.IsWinner(Utility::PlayerSymbol::X) ||
+            current_board.IsWinner(Utility::PlayerSymbol::O))
+    {
+        return result;
+    }
+
+    evaluator.Reset(current_board);
+    orderer.Clear();
+
+    if (table != nullptr)
+    {
+        table->Clear();
+    }
+    for (auto & helper: helpers)
+    {
+        helper.statistics = {};
+        helper.root_move_count = root_move_count;
+        helper.table = table;
+        helper.orderer.SetOrdering(orderer.GetOrdering());
+        helper.orderer.Clear();
+    }
+
+    typename Board::CellList moves {};
+    auto picker = Order_Moves(current_board, current_board.GetCurrentPlayer());
+    for (cell move = 0; picker.Next(move);)
+    {
+        moves.Add(move);
+    }
+
+    if (time_budget == UNLIMITED_TIME)
+    {
+        deadline = NO_DEADLINE;
+        result = Search_Root(current_board, moves, depth_limit, principal_variation);
+    }
+    else
+    {
+        // Searching deeper than the number of empty cells finds nothing new
+        auto const MAX_DEPTH = static_cast<uint8_t>(std::min<cell>(depth_limit, moves.GetSize()));
+        auto const DEADLINE = START + time_budget;
+
+        Line line {};
+        for (uint8_t depth = 1; depth <= MAX_DEPTH; ++depth)
+        {
+            deadline = (depth == 1) ? NO_DEADLINE : DEADLINE;
+
+            auto const ITERATION = Search_Root(current_board, moves, depth, line);
+            if (out_of_time)
+            {
+                break;
+            }
+            result = ITERATION;
+            principal_variation = line;
+
+            auto const BEST = std::find(moves.begin(), moves.end(), result.move);
+            std::rotate(moves.begin(), BEST, BEST + 1);
+
+            if (std::abs(result.score) > WIN_VALUE - Board::CELLS || time_us_64() + TIME_CHECK_PERIOD >= DEADLINE)
+            {
+                break;
+            }
+        }
+    }
+
+    if constexpr (Statistics::ENABLED)
+    {
+        for (auto const & HELPER: helpers)
+        {
+            statistics.Add(HELPER.statistics);
+        }
+        statistics.elapsed = static_cast<uint32_t>(time_us_64() - START);
+    }
+    return result;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::GetSearchStatistics() const noexcept -> Statistics const &
+{
+    return statistics;
+}
+
+template <uint8_t N, uint8_t K, typename Evaluator>
+auto GridSearch<N, K, Evaluator>::GetPrincipalVariation() const noexcept -> Line const &
+{
+    return principal_variation;
+}
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * @file SearchPool.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the SearchPool class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <pico/types.h>
+
+#include <cstdint>
+
+/**
+ * Runs the lanes of a parallel search at the same time. The calling thread
+ * always runs lane 0 and the other lanes run on threads that are started the
+ * first time they are needed and then wait for the next search, so a search
+ * never pays for starting a thread twice.
+ *
+ * It is only built for the host benchmark: on the RP2040 the second core
+ * already runs the whole search while the first one serves the keypad and the
+ * displays, so there is no core left for a second lane. Whether the lanes pay
+ * off depends on the hardware threads of the host, which the benchmark reports
+ * as the speedup of every lane count.
+ */
+class SearchPool final
+{
+ public:
+
+    /**
+     * Work of one lane, given the context of the search and the lane number.
+     */
+    using Job = void (*)(void * context, uint8_t lane);
+
+    /**
+     * Maximum number of lanes of a search.
+     */
+    static constexpr uint8_t MAX_LANES = 64;
+
+    /**
+     * Gets the number of lanes that can actually run at the same time.
+     *
+     * @return The number of hardware threads
+     */
+    [[nodiscard]] static auto GetLaneCount() noexcept -> uint8_t;
+
+    /**
+     * Runs a job on a number of lanes and waits for all of them to finish.
+     * Only one search may use the pool at a time.
+     *
+     * @param lanes The number of lanes, at most MAX_LANES
+     * @param job The job
+     * @param context The context passed to every lane
+     */
+    static void Run(uint8_t lanes, Job job, void * context) noexcept;
+
+    /**
+     * Runs a function object on a number of lanes and waits for all of them
+     * to finish.
+     *
+     * @param lanes The number of lanes, at most MAX_LANES
+     * @param function The function, called with the lane number
+     */
+    template <typename Function>
+    static void Run(uint8_t lanes, Function & function) noexcept;
+};
+
+template <typename Function>
+void SearchPool::Run(uint8_t lanes, Function & function) noexcept
+{
+    Run(lanes, [](void * context, uint8_t lane)
+    {
+        (*static_cast<Function *>(context))(lane);
+    }, &function);
+}
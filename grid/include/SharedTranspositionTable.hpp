@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * @file SharedTranspositionTable.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the SharedTranspositionTable class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <optional>
+#include <cstdint>
+#include <atomic>
+#include <array>
+
+/**
+ * Fixed-size, direct-mapped cache of searched positions that many threads
+ * read and write at the same time without a lock. Every slot holds the data
+ * and the key XOR-ed with the data, as two words that are written one after
+ * the other. When two threads write a slot at once, the words of the slot no
+ * longer agree with each other and the slot reads as a miss, so a probe
+ * never returns the data of another position. Like TranspositionTable, the
+ * table lives entirely inside the object and never allocates.
+ *
+ * @tparam SIZE The number of entries, a power of two
+ */
+template <size_t SIZE>
+class SharedTranspositionTable final
+{
+ public:
+
+    using value = int32_t;
+
+    /**
+     * Relation between a stored value and the real value of the position.
+     */
+    enum class Bound : uint8_t
+    {
+        EXACT,
+        LOWER,
+        UPPER
+    };
+
+    /**
+     * Result of a search of a position.
+     */
+    struct Entry
+    {
+        value score {0};    /* The searched value */
+        uint8_t depth {0};  /* The number of plies searched below the position */
+        Bound bound {};     /* The relation between the value and the real one */
+    };
+
+ private:
+
+    static constexpr uint64_t VALUE_MASK = UINT32_MAX;
+    static constexpr uint8_t DEPTH_SHIFT = 32;
+    static constexpr uint8_t BOUND_SHIFT = 40;
+    static constexpr uint64_t VALID = uint64_t {1} << 63;
+
+    static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "The number of entries must be a power of two");
+
+    struct Slot
+    {
+        std::atomic<uint64_t> check {0};
+        std::atomic<uint64_t> data {0};
+    };
+
+    std::array<Slot, SIZE> slots {};
+
+    /**
+     * Packs an entry into one word. Empty slots are recognised by the missing
+     * valid bit.
+     *
+     * @param entry The entry
+     * @return The data word
+     */
+    [[nodiscard]] static constexpr auto Pack(Entry const & entry) noexcept -> uint64_t;
+
+    /**
+     * Unpacks an entry from its data word.
+     *
+     * @param data The data word
+     * @return The entry
+     */
+    [[nodiscard]] static constexpr auto Unpack(uint64_t data) noexcept -> Entry;
+
+ public:
+
+    /**
+     * [Constructor]
+     */
+    SharedTranspositionTable() noexcept = default;
+
+    /**
+     * Looks up a position.
+     *
+     * @param key The position key
+     * @return The stored entry, or nothing if the position is not found
+     */
+    [[nodiscard]] auto Probe(uint64_t key) const noexcept -> std::optional<Entry>;
+
+    /**
+     * Stores the result of a search, replacing any previous entry that maps
+     * to the same slot.
+     *
+     * @param key The position key
+     * @param entry The result
+     */
+    void Store(uint64_t key, Entry const & entry) noexcept;
+
+    /**
+     * Classifies a searched value based on the window it was searched with.
+     *
+     * @param score The searched value
+     * @param alpha The initial alpha parameter
+     * @param beta The initial beta parameter
+     * @return The bound type
+     */
+    [[nodiscard]] static constexpr auto GetBound(value score, value alpha, value beta) noexcept -> Bound;
+
+    /**
+     * Removes all the stored entries. No search may use the table meanwhile.
+     */
+    void Clear() noexcept;
+};
+
+template <size_t SIZE>
+constexpr auto SharedTranspositionTable<SIZE>::Pack(Entry const & entry) noexcept -> uint64_t
+{
+    return VALID | (static_cast<uint64_t>(entry.bound) << BOUND_SHIFT) |
+           (static_cast<uint64_t>(entry.depth) << DEPTH_SHIFT) | (static_cast<uint32_t>(entry.score) & VALUE_MASK);
+}
+
+template <size_t SIZE>
+constexpr auto SharedTranspositionTable<SIZE>::Unpack(uint64_t data) noexcept -> Entry
+{
+    return {static_cast<value>(static_cast<uint32_t>(data & VALUE_MASK)), static_cast<uint8_t>(data >> DEPTH_SHIFT),
+            static_cast<Bound>((data >> BOUND_SHIFT) & 0b11U)};
+}
+
+template <size_t SIZE>
+auto SharedTranspositionTable<SIZE>::Probe(uint64_t key) const noexcept -> std::optional<Entry>
+{
+    auto const & SLOT = slots[key & (SIZE - 1)];
+
+    // Relaxed loads are enough: a slot read halfway through a write fails the
+    // check below, exactly like a slot written by two threads at once
+    auto const DATA = SLOT.data.load(std::memory_order_relaxed);
+    auto const CHECK = SLOT.check.load(std::memory_order_relaxed);
+
+    if ((DATA & VALID) == 0 || (CHECK ^ DATA) != key)
+    {
+        return std::nullopt;
+    }
+    return Unpack(DATA);
+}
+
+template <size_t SIZE>
+void SharedTranspositionTable<SIZE>::Store(uint64_t key, Entry const & entry) noexcept
+{
+    auto & slot = slots[key & (SIZE - 1)];
+    auto const DATA = Pack(entry);
+
+    slot.check.store(key ^ DATA, std::memory_order_relaxed);
+    slot.data.store(DATA, std::memory_order_relaxed);
+}
+
+template <size_t SIZE>
+constexpr auto SharedTranspositionTable<SIZE>::GetBound(value score, value alpha, value beta) noexcept -> Bound
+{
+    if (score <= alpha)
+    {
+        return Bound::UPPER;
+    }
+    if (score >= beta)
+    {
+        return Bound::LOWER;
+    }
+    return Bound::EXACT;
+}
+
+template <size_t SIZE>
+void SharedTranspositionTable<SIZE>::Clear() noexcept
+{
+    for (auto & slot: slots)
+    {
+        slot.check.store(0, std::memory_order_relaxed);
+        slot.data.store(0, std::memory_order_relaxed);
+    }
+}
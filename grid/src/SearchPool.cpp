@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * @file SearchPool.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the SearchPool class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "SearchPool.hpp"
+
+#include <condition_variable>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+
+namespace
+{
+/**
+ * Shared state of the lanes. It is never destroyed, since the threads still
+ * wait on it when the program exits.
+ */
+struct Pool
+{
+    std::mutex run_mutex;  // Held by the search using the pool
+
+    std::mutex mutex;
+    std::condition_variable started;
+    std::condition_variable finished;
+
+    SearchPool::Job job {nullptr};
+    void * context {nullptr};
+    uint8_t lanes {0};
+    uint8_t running {0};
+    uint32_t generation {0};
+    uint8_t thread_count {0};  // Threads started, for the lanes 1 to thread_count
+};
+
+auto * const pool = new Pool {};
+
+/**
+ * Runs a lane of every search that has enough lanes.
+ *
+ * @param lane The lane number
+ */
+void Serve_Lane(uint8_t lane) noexcept
+{
+    uint32_t seen = 0;
+
+    while (true)
+    {
+        std::unique_lock lock {pool->mutex};
+        pool->started.wait(lock, [&seen] {return pool->generation != seen;});
+        seen = pool->generation;
+
+        if (lane >= pool->lanes)
+        {
+            continue;
+        }
+        auto * const JOB = pool->job;
+        auto * const CONTEXT = pool->context;
+        lock.unlock();
+
+        JOB(CONTEXT, lane);
+
+        lock.lock();
+        if (--pool->running == 0)
+        {
+            pool->finished.notify_one();
+        }
+    }
+}
+}  // namespace
+
+auto SearchPool::GetLaneCount() noexcept -> uint8_t
+{
+    return static_cast<uint8_t>(std::clamp<unsigned>(std::thread::hardware_concurrency(), 1, MAX_LANES));
+}
+
+void SearchPool::Run(uint8_t lanes, Job job, void * context) noexcept
+{
+    if (lanes <= 1)
+    {
+        job(context, 0);
+        return;
+    }
+
+    std::lock_guard const RUN_LOCK {pool->run_mutex};
+    {
+        std::lock_guard const LOCK {pool->mutex};
+
+        // The new threads have seen no search yet, so they join this one
+        for (; pool->thread_count + 1 < lanes; ++pool->thread_count)
+        {
+            std::thread {Serve_Lane, static_cast<uint8_t>(pool->thread_count + 1)}.detach();
+        }
+
+        pool->job = job;
+        pool->context = context;
+        pool->lanes = lanes;
+        pool->running = static_cast<uint8_t>(lanes - 1);
+        ++pool->generation;
+    }
+    pool->started.notify_all();
+
+    job(context, 0);
+
+    std::unique_lock lock {pool->mutex};
+    pool->finished.wait(lock, [] {return pool->running == 0;});
+}
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * @file HD44780.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the HD44780 class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <array>
+#include <mutex>
+
+/**
+ * Emulation of a HD44780 character LCD driven in 4-bit mode through a PCF8574
+ * I2C expander (P0 = RS, P1 = RW, P2 = EN, P3 = backlight, P4-P7 = D4-D7).
+ * It also keeps a timing model: the time of every byte is the time the bus
+ * takes to send it, or the wall time if that is later, and an enable pulse
+ * that starts a write while the display is still executing the previous
+ * instruction, or that changes the register select or read/write lines at the
+ * same time, counts as a timing violation.
+ */
+class HD44780 final
+{
+ public:
+
+    using byte = uint8_t;
+
+    static constexpr byte ROWS = 4;
+    static constexpr byte COLUMNS = 20;
+    static constexpr byte CUSTOM_CHARS = 8;
+
+ private:
+
+    static constexpr byte REGISTER_SELECT = 0x01;
+    static constexpr byte READ_WRITE = 0x02;
+    static constexpr byte ENABLE = 0x04;
+    static constexpr byte BACKLIGHT = 0x08;
+    static constexpr byte DDRAM_SIZE = 0x80;
+    static constexpr byte CGRAM_SIZE = 0x40;
+
+    mutable std::mutex mutex;
+
+    std::array<byte, DDRAM_SIZE> ddram {};
+    std::array<byte, CGRAM_SIZE> cgram {};
+    std::array<char, CUSTOM_CHARS> glyphs {};
+
+    byte address {0};
+    bool cgram_selected {false};
+    bool increment {true};
+    bool four_bit_mode {false};
+    bool display_on {false};
+    bool backlight {false};
+
+    bool enable_high {false};
+    bool waiting_low_nibble {false};
+    byte high_nibble {0};
+    byte last_port {0};
+
+    uint32_t version {0};
+
+    uint64_t clock {0};          /* Model time in nanoseconds */
+    uint64_t bus_time {0};       /* Time spent sending bytes in nanoseconds */
+    uint64_t busy_until {0};     /* End of the current execution in nanoseconds */
+    uint32_t byte_time {0};      /* Time to send a byte in nanoseconds */
+    uint32_t timing_violations {0};
+    uint32_t executions {0};
+    bool reading_low_nibble {false};
+
+    /**
+     * Moves the model time forward for an I2C transaction.
+     *
+     * @param length The number of bytes after the address
+     */
+    void Start_Transaction(size_t length) noexcept;
+
+    /**
+     * Gets the time the display takes to execute a byte, from the HD44780
+     * datasheet.
+     *
+     * @param value The instruction or data byte
+     * @param is_data True for a data write
+     * @return The execution time in nanoseconds
+     */
+    [[nodiscard]] static auto Get_Execution_Time(byte value, bool is_data) noexcept -> uint32_t;
+
+    /**
+     * Executes an instruction.
+     *
+     * @param instruction The instruction byte
+     */
+    void Execute_Instruction(byte instruction) noexcept;
+
+    /**
+     * Writes a byte to the selected RAM and moves the address counter.
+     *
+     * @param data The data byte
+     */
+    void Write_Data(byte data) noexcept;
+
+    /**
+     * Handles a byte latched on the falling edge of the enable signal.
+     *
+     * @param port The expander port value
+     */
+    void Latch(byte port) noexcept;
+
+ public:
+
+    /**
+     * [Constructor] Sets the power-on state, i.e. 8-bit mode and blank DDRAM.
+     */
+    HD44780() noexcept;
+
+    /**
+     * Receives the bytes written to the I2C expander.
+     *
+     * @param data The bytes
+     * @param length The number of bytes
+     * @return True, since the expander acknowledges every byte
+     */
+    auto Write(uint8_t const * data, size_t length) noexcept -> bool;
+
+    /**
+     * Reads the port of the I2C expander. While the enable signal is high in
+     * a read cycle, the data lines show the busy flag and the address
+     * counter, one nibble per enable pulse.
+     *
+     * @param data The bytes read
+     * @param length The number of bytes
+     * @return True, since the expander acknowledges every byte
+     */
+    auto Read(uint8_t * data, size_t length) noexcept -> bool;
+
+    /**
+     * Sets the speed of the I2C bus used by the timing model.
+     *
+     * @param baud_rate The bus speed in bits per second
+     */
+    void SetBusSpeed(uint32_t baud_rate) noexcept;
+
+    /**
+     * Sets the characters used to print the custom characters.
+     *
+     * @param custom_glyphs One character for every custom character location
+     */
+    void SetGlyphs(std::string_view custom_glyphs) noexcept;
+
+    /**
+     * Gets a line of the display as text.
+     *
+     * @param row The row
+     * @return The text
+     */
+    [[nodiscard]] auto GetLine(byte row) const noexcept -> std::string;
+
+    /**
+     * Checks if the backlight is on.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] auto IsBacklightOn() const noexcept -> bool;
+
+    /**
+     * Gets a counter increased on every visible change.
+     *
+     * @return The counter
+     */
+    [[nodiscard]] auto GetVersion() const noexcept -> uint32_t;
+
+    /**
+     * Gets the number of enable pulses that broke the timing of the display.
+     *
+     * @return The number of violations
+     */
+    [[nodiscard]] auto GetTimingViolations() const noexcept -> uint32_t;
+
+    /**
+     * Gets the time spent sending bytes to the expander.
+     *
+     * @return The time in nanoseconds
+     */
+    [[nodiscard]] auto GetBusTime() const noexcept -> uint64_t;
+
+    /**
+     * Gets the number of instructions and data writes executed.
+     *
+     * @return The number of executions
+     */
+    [[nodiscard]] auto GetExecutions() const noexcept -> uint32_t;
+};
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * @file Host.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the Host namespace.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <hardware/i2c.h>
+#include <hardware/pio.h>
+
+#include <initializer_list>
+#include <functional>
+#include <cstdint>
+#include <utility>
+
+/**
+ * Wiring of the emulated peripherals behind the Pico SDK stand-in layer.
+ */
+namespace Host
+{
+/**
+ * Handler that receives the bytes written to an I2C device and returns
+ * whether they were acknowledged.
+ */
+using I2CDevice = std::function<bool(uint8_t const * data, size_t length)>;
+
+/**
+ * Handler that fills the bytes read from an I2C device and returns whether
+ * they were acknowledged.
+ */
+using I2CReader = std::function<bool(uint8_t * data, size_t length)>;
+
+/**
+ * Handler that receives the words pushed to a PIO state machine.
+ */
+using PIODevice = std::function<void(uint32_t word)>;
+
+/**
+ * Contact between an output pin and an input pin, like a key of a matrix
+ * keypad.
+ */
+using Contact = std::pair<uint, uint>;
+
+/**
+ * Connects an emulated device to an I2C bus. Writes to addresses without a
+ * device are not acknowledged. Reads from a device without a reader return
+ * zeros.
+ *
+ * @param i2c The I2C instance
+ * @param address The 7-bit device address
+ * @param device The device handler
+ * @param reader The handler of the reads
+ */
+void AttachI2CDevice(i2c_inst_t * i2c, uint8_t address, I2CDevice device, I2CReader reader = {}) noexcept;
+
+/**
+ * Limits the speed at which an emulated I2C device acknowledges, like a part
+ * that is only rated for the standard or fast mode.
+ *
+ * @param i2c The I2C instance
+ * @param address The 7-bit device address
+ * @param baud_rate The fastest speed in bits per second
+ */
+void SetI2CDeviceSpeed(i2c_inst_t * i2c, uint8_t address, uint baud_rate) noexcept;
+
+/**
+ * Connects an emulated device to every state machine of a PIO block.
+ *
+ * @param pio The PIO instance
+ * @param device The device handler
+ */
+void AttachPIODevice(PIO pio, PIODevice device) noexcept;
+
+/**
+ * Closes the contact between two pins, like a short press of a key of a
+ * matrix keypad: the contact opens again after 100 ms. If the output pin is
+ * driven high, the rising edge interrupt of the input pin is raised, and it is
+ * raised again every time the output pin goes high while the contact is
+ * closed.
+ *
+ * @param output_pin The pin driving the contact (the keypad row)
+ * @param input_pin The pin reading the contact (the keypad column)
+ */
+void PressContact(uint output_pin, uint input_pin) noexcept;
+
+/**
+ * Closes several contacts at once, like keys held together, before raising
+ * any interrupt.
+ *
+ * @param new_contacts The contacts, as pairs of output and input pins
+ */
+void PressContacts(std::initializer_list<Contact> new_contacts) noexcept;
+
+/**
+ * Pushes a word to the TX FIFO of an I2C controller, like a DMA channel paced
+ * by its DREQ. The bytes are written to the device at the target address
+ * (TAR) once a word with the STOP bit arrives; then the STOP_DET and, if the
+ * device did not acknowledge them, TX_ABRT interrupts are raised.
+ *
+ * @param i2c The I2C instance
+ * @param data_cmd The DATA_CMD word
+ */
+void WriteI2CDataCommand(i2c_inst_t * i2c, uint32_t data_cmd) noexcept;
+
+/**
+ * Raises an interrupt from an emulated peripheral. Its handler runs on the
+ * calling thread if the interrupt is enabled, otherwise it stays pending
+ * until it is.
+ *
+ * @param num The interrupt number
+ */
+void RaiseInterrupt(uint num) noexcept;
+}  // namespace Host
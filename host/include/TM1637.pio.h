@@ -0,0 +1,20 @@
+/*******************************************************************************
+ * @file TM1637.pio.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the header generated from pio/TM1637.pio.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "hardware/pio.h"
+
+inline constexpr pio_program_t TM1637_program {nullptr, 0, -1};
+
+static inline auto TM1637_program_get_default_config(uint offset) noexcept -> pio_sm_config
+{
+    static_cast<void>(offset);
+    return pio_get_default_sm_config();
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * @file TM1637Display.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the TM1637Display class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <array>
+#include <mutex>
+
+/**
+ * Emulation of a 4 digit TM1637 display fed by the words that the TM1637 PIO
+ * program receives. Each word is sent as two transfers: its first byte, then
+ * its remaining three bytes. The first byte of a transfer is a command and
+ * the next ones are written to the digits at the current address.
+ */
+class TM1637Display final
+{
+ public:
+
+    using byte = uint8_t;
+
+    static constexpr byte DIGITS = 4;
+
+ private:
+
+    static constexpr byte BYTE_SIZE = 8;
+    static constexpr byte COMMAND_MASK = 0xC0;
+    static constexpr byte DISPLAY_CONTROL = 0x80;
+    static constexpr byte ADDRESS_COMMAND = 0xC0;
+    static constexpr byte DISPLAY_ON = 0x08;
+    static constexpr byte BRIGHTNESS_MASK = 0x07;
+    static constexpr byte COLON = 0x80;
+
+    mutable std::mutex mutex;
+
+    std::array<byte, DIGITS> segments {};
+    byte address {0};
+    byte brightness {0};
+    bool display_on {false};
+
+    uint32_t version {0};
+
+    /**
+     * Handles a transfer.
+     *
+     * @param command The first byte
+     * @param data The next bytes
+     * @param length The number of next bytes
+     */
+    void Transfer(byte command, byte const * data, size_t length) noexcept;
+
+    /**
+     * Converts the segments of a digit to a character.
+     *
+     * @param digit_segments The segments of the digit
+     * @return The character
+     */
+    [[gnu::const]] static auto Segments_To_Char(byte digit_segments) noexcept -> char;
+
+ public:
+
+    /**
+     * Receives a word pushed to the state machine.
+     *
+     * @param word The word
+     */
+    void Write(uint32_t word) noexcept;
+
+    /**
+     * Gets the display as text, e.g. "12:03".
+     *
+     * @return The text
+     */
+    [[nodiscard]] auto GetText() const noexcept -> std::string;
+
+    /**
+     * Gets the brightness level.
+     *
+     * @return The brightness
+     */
+    [[nodiscard]] auto GetBrightness() const noexcept -> byte;
+
+    /**
+     * Gets a counter increased on every visible change.
+     *
+     * @return The counter
+     */
+    [[nodiscard]] auto GetVersion() const noexcept -> uint32_t;
+};
@@ -0,0 +1,29 @@
+/*******************************************************************************
+ * @file clocks.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK clock functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+enum clock_index
+{
+    clk_gpout0 = 0,
+    clk_gpout1,
+    clk_gpout2,
+    clk_gpout3,
+    clk_ref,
+    clk_sys,
+    clk_peri,
+    clk_usb,
+    clk_adc,
+    clk_rtc,
+    CLK_COUNT
+};
+
+auto clock_get_hz(clock_index clock) noexcept -> uint32_t;
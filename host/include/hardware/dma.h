@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * @file dma.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK DMA functions, copying the transfers on a background thread.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+#define DREQ_I2C0_TX 32
+#define DREQ_I2C0_RX 33
+#define DREQ_I2C1_TX 34
+#define DREQ_I2C1_RX 35
+#define DREQ_FORCE 63
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+struct dma_channel_config
+{
+    dma_channel_transfer_size transfer_size;
+    bool read_increment;
+    bool write_increment;
+    uint dreq;
+};
+
+auto dma_claim_unused_channel(bool required) noexcept -> int;
+
+auto dma_channel_get_default_config(uint channel) noexcept -> dma_channel_config;
+
+void channel_config_set_transfer_data_size(dma_channel_config * config, dma_channel_transfer_size size) noexcept;
+
+void channel_config_set_read_increment(dma_channel_config * config, bool increment) noexcept;
+
+void channel_config_set_write_increment(dma_channel_config * config, bool increment) noexcept;
+
+void channel_config_set_dreq(dma_channel_config * config, uint dreq) noexcept;
+
+void dma_channel_configure(uint channel, dma_channel_config const * config, void volatile * write_addr,
+                           void const volatile * read_addr, uint transfer_count, bool trigger) noexcept;
+
+void dma_channel_transfer_from_buffer_now(uint channel, void const volatile * read_addr,
+                                          uint32_t transfer_count) noexcept;
+
+auto dma_channel_is_busy(uint channel) noexcept -> bool;
+
+void dma_channel_abort(uint channel) noexcept;
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) noexcept;
+
+auto dma_channel_get_irq0_status(uint channel) noexcept -> bool;
+
+void dma_channel_acknowledge_irq0(uint channel) noexcept;
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * @file gpio.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK GPIO functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+#define GPIO_OUT true
+#define GPIO_IN false
+
+enum gpio_function
+{
+    GPIO_FUNC_XIP = 0,
+    GPIO_FUNC_SPI = 1,
+    GPIO_FUNC_UART = 2,
+    GPIO_FUNC_I2C = 3,
+    GPIO_FUNC_PWM = 4,
+    GPIO_FUNC_SIO = 5,
+    GPIO_FUNC_PIO0 = 6,
+    GPIO_FUNC_PIO1 = 7,
+    GPIO_FUNC_GPCK = 8,
+    GPIO_FUNC_USB = 9,
+    GPIO_FUNC_NULL = 0x1F
+};
+
+enum gpio_irq_level
+{
+    GPIO_IRQ_LEVEL_LOW = 0x1U,
+    GPIO_IRQ_LEVEL_HIGH = 0x2U,
+    GPIO_IRQ_EDGE_FALL = 0x4U,
+    GPIO_IRQ_EDGE_RISE = 0x8U
+};
+
+/**
+ * Handler of the GPIO interrupts of a core.
+ */
+typedef void (* gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+
+void gpio_init(uint gpio) noexcept;
+
+void gpio_set_dir(uint gpio, bool out) noexcept;
+
+void gpio_put(uint gpio, bool value) noexcept;
+
+auto gpio_get(uint gpio) noexcept -> bool;
+
+void gpio_pull_up(uint gpio) noexcept;
+
+void gpio_pull_down(uint gpio) noexcept;
+
+void gpio_set_function(uint gpio, gpio_function function) noexcept;
+
+/**
+ * Enables or disables interrupts of a pin. Only the rising edges are
+ * emulated, latched when a contact is closed against a pin driven high or
+ * when the pin driving a closed contact goes high. An edge latched while the
+ * interrupt was disabled is raised as soon as it is enabled.
+ *
+ * @param gpio The pin
+ * @param event_mask The gpio_irq_level events
+ * @param enabled Whether the events are enabled or disabled
+ */
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) noexcept;
+
+/**
+ * Enables the interrupts of a pin and sets the handler of all of them, like
+ * gpio_set_irq_enabled().
+ *
+ * @param gpio The pin
+ * @param event_mask The gpio_irq_level events
+ * @param enabled Whether the events are enabled or disabled
+ * @param callback The handler
+ */
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled,
+                                        gpio_irq_callback_t callback) noexcept;
+
+/**
+ * Clears the latched edges of a pin, which the handler of its interrupt
+ * otherwise gets again.
+ *
+ * @param gpio The pin
+ * @param event_mask The gpio_irq_level events
+ */
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask) noexcept;
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * @file i2c.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK I2C functions, forwarding the transfers to emulated devices.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+#include "pico/time.h"
+
+#include <cstddef>
+
+#define I2C_IC_DATA_CMD_STOP_BITS 0x00000200U
+#define I2C_IC_STATUS_ACTIVITY_BITS 0x00000001U
+#define I2C_IC_STATUS_TFE_BITS 0x00000004U
+#define I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS 0x00000001U
+#define I2C_IC_TX_ABRT_SOURCE_ABRT_TXDATA_NOACK_BITS 0x00000008U
+#define I2C_IC_INTR_MASK_M_TX_ABRT_BITS 0x00000040U
+#define I2C_IC_INTR_MASK_M_STOP_DET_BITS 0x00000200U
+#define I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS 0x00000040U
+#define I2C_IC_RAW_INTR_STAT_STOP_DET_BITS 0x00000200U
+
+#define NUM_I2CS 2
+
+struct i2c_hw_t
+{
+    uint32_t volatile enable;
+    uint32_t volatile tar;
+    uint32_t volatile data_cmd;
+    uint32_t volatile status;
+    uint32_t volatile tx_abrt_source;
+    uint32_t volatile clr_tx_abrt;
+    uint32_t volatile intr_mask;
+    uint32_t volatile raw_intr_stat;
+    uint32_t volatile clr_stop_det;
+};
+
+struct i2c_inst
+{
+    i2c_hw_t hw;
+    uint baudrate;
+};
+
+typedef struct i2c_inst i2c_inst_t;
+
+extern i2c_inst_t host_i2c0_inst;
+extern i2c_inst_t host_i2c1_inst;
+
+#define i2c0 (&host_i2c0_inst)
+#define i2c1 (&host_i2c1_inst)
+
+#define PICO_DEFAULT_I2C 0
+#define PICO_DEFAULT_I2C_INSTANCE i2c0
+#define PICO_DEFAULT_I2C_SDA_PIN 4
+#define PICO_DEFAULT_I2C_SCL_PIN 5
+
+auto i2c_init(i2c_inst_t * i2c, uint baudrate) noexcept -> uint;
+
+auto i2c_set_baudrate(i2c_inst_t * i2c, uint baudrate) noexcept -> uint;
+
+auto i2c_write_blocking(i2c_inst_t * i2c, uint8_t addr, uint8_t const * src, size_t len, bool nostop) noexcept -> int;
+
+auto i2c_get_hw(i2c_inst_t * i2c) noexcept -> i2c_hw_t *;
+
+auto i2c_hw_index(i2c_inst_t * i2c) noexcept -> uint;
+
+auto i2c_get_dreq(i2c_inst_t * i2c, bool is_tx) noexcept -> uint;
+
+auto i2c_read_blocking(i2c_inst_t * i2c, uint8_t addr, uint8_t * dst, size_t len, bool nostop) noexcept -> int;
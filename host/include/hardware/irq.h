@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * @file irq.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK interrupt functions, running the handlers raised by emulated peripherals.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+#define DMA_IRQ_0 11
+#define DMA_IRQ_1 12
+#define I2C0_IRQ 23
+#define I2C1_IRQ 24
+
+typedef void (* irq_handler_t)();
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) noexcept;
+
+void irq_set_enabled(uint num, bool enabled) noexcept;
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * @file pio.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK PIO functions, forwarding the TX FIFO words to emulated devices.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+#include "hardware/gpio.h"
+
+struct pio_program
+{
+    uint16_t const * instructions;
+    uint8_t length;
+    int8_t origin;
+};
+
+typedef struct pio_program pio_program_t;
+
+struct pio_sm_config
+{
+    uint32_t clkdiv;
+    uint32_t execctrl;
+    uint32_t shiftctrl;
+    uint32_t pinctrl;
+};
+
+struct pio_hw_t
+{
+    uint8_t claimed_state_machines;
+    uint8_t used_instructions;
+};
+
+typedef pio_hw_t * PIO;
+
+extern pio_hw_t host_pio0_hw;
+extern pio_hw_t host_pio1_hw;
+
+#define pio0 (&host_pio0_hw)
+#define pio1 (&host_pio1_hw)
+
+auto pio_get_default_sm_config() noexcept -> pio_sm_config;
+
+void pio_gpio_init(PIO pio, uint pin) noexcept;
+
+auto pio_claim_unused_sm(PIO pio, bool required) noexcept -> int;
+
+auto pio_add_program(PIO pio, pio_program_t const * program) noexcept -> uint;
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, pio_sm_config const * config) noexcept;
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) noexcept;
+
+void pio_sm_set_pins_with_mask(PIO pio, uint sm, uint32_t pin_values, uint32_t pin_mask) noexcept;
+
+void pio_sm_set_pindirs_with_mask(PIO pio, uint sm, uint32_t pin_dirs, uint32_t pin_mask) noexcept;
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) noexcept;
+
+void sm_config_set_sideset_pins(pio_sm_config * config, uint sideset_base) noexcept;
+
+void sm_config_set_out_pins(pio_sm_config * config, uint out_base, uint out_count) noexcept;
+
+void sm_config_set_set_pins(pio_sm_config * config, uint set_base, uint set_count) noexcept;
+
+void sm_config_set_out_shift(pio_sm_config * config, bool shift_right, bool autopull, uint pull_threshold) noexcept;
+
+void sm_config_set_clkdiv(pio_sm_config * config, float div) noexcept;
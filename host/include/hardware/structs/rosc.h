@@ -0,0 +1,30 @@
+/*******************************************************************************
+ * @file rosc.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK ring oscillator registers.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+/**
+ * Register whose reads return a fresh random bit, like the RANDOMBIT register
+ * of the ring oscillator.
+ */
+struct host_random_bit_t
+{
+    operator uint32_t() const noexcept;
+};
+
+struct rosc_hw_t
+{
+    host_random_bit_t randombit;
+};
+
+extern rosc_hw_t host_rosc_hw;
+
+#define rosc_hw (&host_rosc_hw)
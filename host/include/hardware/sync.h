@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * @file sync.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK processor event functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+/**
+ * Signals an event to both cores, waking them from __wfe().
+ */
+void __sev() noexcept;
+
+/**
+ * Blocks the calling core until an event is signalled, unless one already was
+ * since the last call. Like on the hardware, it can also return spuriously.
+ */
+void __wfe() noexcept;
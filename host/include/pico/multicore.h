@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * @file multicore.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK multicore functions, where each core is a host thread.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+/**
+ * Starts a function on a new thread that plays the role of the second core.
+ *
+ * @param entry The function to be run
+ */
+void multicore_launch_core1(void (* entry)()) noexcept;
+
+/**
+ * Pushes a value to the FIFO read by the other core, blocking while it is
+ * full.
+ *
+ * @param data The value
+ */
+void multicore_fifo_push_blocking(uint32_t data) noexcept;
+
+/**
+ * Pops a value from the FIFO written by the other core, blocking while it is
+ * empty.
+ *
+ * @return The value
+ */
+auto multicore_fifo_pop_blocking() noexcept -> uint32_t;
+
+/**
+ * Checks if the FIFO written by the other core has data.
+ *
+ * @return True or False
+ */
+auto multicore_fifo_rvalid() noexcept -> bool;
+
+/**
+ * Checks if the FIFO read by the other core has space.
+ *
+ * @return True or False
+ */
+auto multicore_fifo_wready() noexcept -> bool;
+
+/**
+ * Gets the number of the core running the calling thread.
+ *
+ * @return 0 or 1
+ */
+auto get_core_num() noexcept -> uint;
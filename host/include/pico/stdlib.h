@@ -0,0 +1,19 @@
+/*******************************************************************************
+ * @file stdlib.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK standard library header.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+#include "pico/time.h"
+#include "hardware/gpio.h"
+
+/**
+ * Marks the body of a busy-wait loop, which is empty like on the hardware.
+ */
+inline void tight_loop_contents() noexcept {}
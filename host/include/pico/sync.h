@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * @file sync.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK synchronisation primitives.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "hardware/sync.h"
+#include "pico/types.h"
+
+#include <mutex>
+
+/**
+ * Lock shared by both cores, backed by a mutex instead of a hardware spin
+ * lock.
+ */
+struct critical_section
+{
+    std::mutex mutex;
+};
+
+typedef struct critical_section critical_section_t;
+
+/**
+ * Initialises a critical section.
+ *
+ * @param crit_sec The critical section
+ */
+void critical_section_init(critical_section_t * crit_sec) noexcept;
+
+/**
+ * Enters a critical section, blocking while the other core is inside it.
+ *
+ * @param crit_sec The critical section
+ */
+void critical_section_enter_blocking(critical_section_t * crit_sec) noexcept;
+
+/**
+ * Leaves a critical section.
+ *
+ * @param crit_sec The critical section
+ */
+void critical_section_exit(critical_section_t * crit_sec) noexcept;
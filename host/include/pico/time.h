@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * @file time.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK time functions, backed by the host steady clock.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pico/types.h"
+
+typedef int32_t alarm_id_t;
+
+/**
+ * Function called when an alarm fires. It returns 0 so that the alarm is not
+ * set again, or the time until the alarm fires again in microseconds.
+ */
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void * user_data);
+
+/**
+ * Gets the time elapsed since the program started.
+ *
+ * @return The time in microseconds
+ */
+auto get_absolute_time() noexcept -> absolute_time_t;
+
+/**
+ * Converts an absolute time to milliseconds since the program started.
+ *
+ * @param time The absolute time
+ * @return The time in milliseconds
+ */
+auto to_ms_since_boot(absolute_time_t time) noexcept -> uint32_t;
+
+/**
+ * Converts an absolute time to microseconds since the program started.
+ *
+ * @param time The absolute time
+ * @return The time in microseconds
+ */
+auto to_us_since_boot(absolute_time_t time) noexcept -> uint64_t;
+
+/**
+ * Gets the time elapsed since the program started.
+ *
+ * @return The time in microseconds
+ */
+auto time_us_64() noexcept -> uint64_t;
+
+/**
+ * Gets the lower 32 bits of the time elapsed since the program started.
+ *
+ * @return The time in microseconds
+ */
+auto time_us_32() noexcept -> uint32_t;
+
+/**
+ * Blocks the calling thread.
+ *
+ * @param us The delay in microseconds
+ */
+void sleep_us(uint64_t us) noexcept;
+
+/**
+ * Spins for a short delay. Unlike sleep_us, it is safe in an interrupt
+ * handler.
+ *
+ * @param delay_us The delay in microseconds
+ */
+void busy_wait_us_32(uint32_t delay_us) noexcept;
+
+/**
+ * Blocks the calling thread.
+ *
+ * @param ms The delay in milliseconds
+ */
+void sleep_ms(uint32_t ms) noexcept;
+
+/**
+ * Blocks the calling thread until an absolute time.
+ *
+ * @param target The absolute time
+ */
+void sleep_until(absolute_time_t target) noexcept;
+
+/**
+ * Calls a function once a delay has passed, like an interrupt of the first
+ * core, and again as long as it returns a delay. The function runs on a
+ * thread of its own.
+ *
+ * @param ms The delay in milliseconds
+ * @param callback The function
+ * @param user_data The argument of the function
+ * @param fire_if_past Ignored, since the alarm always fires
+ * @return The alarm
+ */
+auto add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void * user_data,
+                     bool fire_if_past) noexcept -> alarm_id_t;
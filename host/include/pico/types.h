@@ -0,0 +1,29 @@
+/*******************************************************************************
+ * @file types.h
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host stand-in for the Pico SDK base types.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * The code is not running on the RP2040, like the host builds of the SDK.
+ */
+#define PICO_ON_DEVICE 0
+
+typedef unsigned int uint;
+
+typedef uint64_t absolute_time_t;
+
+enum pico_error_codes
+{
+    PICO_OK = 0,
+    PICO_ERROR_NONE = 0,
+    PICO_ERROR_TIMEOUT = -1,
+    PICO_ERROR_GENERIC = -2
+};
@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * @file Clocks.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK clock and ring oscillator functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/structs/rosc.h>
+#include <hardware/clocks.h>
+
+#include <random>
+
+rosc_hw_t host_rosc_hw {};
+
+auto clock_get_hz(clock_index clock) noexcept -> uint32_t
+{
+    static constexpr uint32_t SYSTEM_FREQUENCY = 125'000'000;
+    static constexpr uint32_t USB_FREQUENCY = 48'000'000;
+    static constexpr uint32_t REFERENCE_FREQUENCY = 12'000'000;
+
+    switch (clock)
+    {
+        case clk_sys:
+        case clk_peri:
+            return SYSTEM_FREQUENCY;
+        case clk_usb:
+        case clk_adc:
+            return USB_FREQUENCY;
+        default:
+            return REFERENCE_FREQUENCY;
+    }
+}
+
+host_random_bit_t::operator uint32_t() const noexcept
+{
+    static std::random_device source;
+    return source() & 1U;
+}
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ * @file DMA.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK DMA functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/dma.h>
+#include <hardware/i2c.h>
+#include <hardware/irq.h>
+
+#include "Host.hpp"
+
+#include <condition_variable>
+#include <algorithm>
+#include <thread>
+#include <deque>
+#include <mutex>
+#include <array>
+
+namespace
+{
+constexpr uint CHANNELS = 12;
+
+struct Channel
+{
+    dma_channel_config config {};
+    void volatile * write_address {nullptr};
+    void const volatile * read_address {nullptr};
+    uint32_t transfer_count {0};
+    bool claimed {false};
+    bool busy {false};
+    bool irq0_enabled {false};
+    bool irq0_status {false};
+};
+
+/**
+ * The channels and the queue of triggered ones, served in order by a single
+ * thread standing in for the DMA engine. It is never destroyed, since the
+ * thread is detached and may still be waiting when the program exits.
+ */
+struct Engine
+{
+    std::mutex mutex;
+    std::condition_variable triggered;
+    std::array<Channel, CHANNELS> channels {};
+    std::deque<uint> queue {};
+    std::once_flag started;
+};
+
+auto * const engine = new Engine {};
+
+/**
+ * Reads one element of a transfer.
+ *
+ * @param address The element address
+ * @param size The element size
+ * @return The element
+ */
+auto Read_Element(void const volatile * address, dma_channel_transfer_size size) noexcept -> uint32_t
+{
+    switch (size)
+    {
+        case DMA_SIZE_8:
+            return *static_cast<uint8_t const volatile *>(address);
+        case DMA_SIZE_16:
+            return *static_cast<uint16_t const volatile *>(address);
+        default:
+            return *static_cast<uint32_t const volatile *>(address);
+    }
+}
+
+/**
+ * Writes one element of a transfer, to a peripheral if the channel is paced
+ * by one or to memory otherwise.
+ *
+ * @param config The channel configuration
+ * @param address The element address
+ * @param value The element
+ */
+void Write_Element(dma_channel_config const & config, void volatile * address, uint32_t value) noexcept
+{
+    switch (config.dreq)
+    {
+        case DREQ_I2C0_TX:
+            Host::WriteI2CDataCommand(i2c0, value);
+            return;
+        case DREQ_I2C1_TX:
+            Host::WriteI2CDataCommand(i2c1, value);
+            return;
+        default:
+            break;
+    }
+    switch (config.transfer_size)
+    {
+        case DMA_SIZE_8:
+            *static_cast<uint8_t volatile *>(address) = static_cast<uint8_t>(value);
+            break;
+        case DMA_SIZE_16:
+            *static_cast<uint16_t volatile *>(address) = static_cast<uint16_t>(value);
+            break;
+        default:
+            *static_cast<uint32_t volatile *>(address) = value;
+            break;
+    }
+}
+
+/**
+ * Serves the triggered channels forever.
+ */
+[[noreturn]] void Run_Engine() noexcept
+{
+    while (true)
+    {
+        Channel transfer {};
+        uint channel {0};
+
+        {
+            std::unique_lock lock {engine->mutex};
+            engine->triggered.wait(lock, [] {return !engine->queue.empty();});
+            channel = engine->queue.front();
+            engine->queue.pop_front();
+            transfer = engine->channels[channel];
+        }
+
+        auto const STEP = uint32_t {1} << transfer.config.transfer_size;
+        auto const * read = static_cast<uint8_t const volatile *>(transfer.read_address);
+        auto * write = static_cast<uint8_t volatile *>(transfer.write_address);
+        for (uint32_t element = 0; element < transfer.transfer_count; ++element)
+        {
+            Write_Element(transfer.config, write, Read_Element(read, transfer.config.transfer_size));
+            read += transfer.config.read_increment ? STEP : 0;
+            write += transfer.config.write_increment ? STEP : 0;
+        }
+
+        bool raise {false};
+        {
+            std::lock_guard lock {engine->mutex};
+            auto & finished = engine->channels[channel];
+            finished.busy = std::find(engine->queue.begin(), engine->queue.end(), channel) != engine->queue.end();
+            finished.irq0_status = true;
+            raise = finished.irq0_enabled;
+        }
+        if (raise)
+        {
+            Host::RaiseInterrupt(DMA_IRQ_0);
+        }
+    }
+}
+
+/**
+ * Queues a channel for the engine, starting the engine on first use.
+ *
+ * @param channel The channel
+ */
+void Trigger(uint channel) noexcept
+{
+    std::call_once(engine->started, []
+    {
+        std::thread {Run_Engine}.detach();
+    });
+
+    {
+        std::lock_guard lock {engine->mutex};
+        engine->channels.at(channel).busy = true;
+        engine->queue.push_back(channel);
+    }
+    engine->triggered.notify_one();
+}
+}  // namespace
+
+auto dma_claim_unused_channel(bool required) noexcept -> int
+{
+    static_cast<void>(required);
+
+    std::lock_guard lock {engine->mutex};
+    for (uint channel = 0; channel < CHANNELS; ++channel)
+    {
+        if (!engine->channels[channel].claimed)
+        {
+            engine->channels[channel].claimed = true;
+            return static_cast<int>(channel);
+        }
+    }
+    return -1;
+}
+
+auto dma_channel_get_default_config(uint channel) noexcept -> dma_channel_config
+{
+    static_cast<void>(channel);
+
+    return {DMA_SIZE_32, true, false, DREQ_FORCE};
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config * config, dma_channel_transfer_size size) noexcept
+{
+    config->transfer_size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config * config, bool increment) noexcept
+{
+    config->read_increment = increment;
+}
+
+void channel_config_set_write_increment(dma_channel_config * config, bool increment) noexcept
+{
+    config->write_increment = increment;
+}
+
+void channel_config_set_dreq(dma_channel_config * config, uint dreq) noexcept
+{
+    config->dreq = dreq;
+}
+
+void dma_channel_configure(uint channel, dma_channel_config const * config, void volatile * write_addr,
+                           void const volatile * read_addr, uint transfer_count, bool trigger) noexcept
+{
+    {
+        std::lock_guard lock {engine->mutex};
+        auto & configured = engine->channels.at(channel);
+        configured.config = *config;
+        configured.write_address = write_addr;
+        configured.read_address = read_addr;
+        configured.transfer_count = transfer_count;
+    }
+    if (trigger)
+    {
+        Trigger(channel);
+    }
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, void const volatile * read_addr,
+                                          uint32_t transfer_count) noexcept
+{
+    {
+        std::lock_guard lock {engine->mutex};
+        auto & configured = engine->channels.at(channel);
+        configured.read_address = read_addr;
+        configured.transfer_count = transfer_count;
+    }
+    Trigger(channel);
+}
+
+auto dma_channel_is_busy(uint channel) noexcept -> bool
+{
+    std::lock_guard lock {engine->mutex};
+    return engine->channels.at(channel).busy;
+}
+
+void dma_channel_abort(uint channel) noexcept
+{
+    // A transfer already being served runs to its end, like one that finished before the abort
+    std::lock_guard lock {engine->mutex};
+    std::erase(engine->queue, channel);
+    engine->channels.at(channel).busy = false;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) noexcept
+{
+    std::lock_guard lock {engine->mutex};
+    engine->channels.at(channel).irq0_enabled = enabled;
+}
+
+auto dma_channel_get_irq0_status(uint channel) noexcept -> bool
+{
+    std::lock_guard lock {engine->mutex};
+    auto const & CHANNEL = engine->channels.at(channel);
+    return CHANNEL.irq0_enabled && CHANNEL.irq0_status;
+}
+
+void dma_channel_acknowledge_irq0(uint channel) noexcept
+{
+    std::lock_guard lock {engine->mutex};
+    engine->channels.at(channel).irq0_status = false;
+}
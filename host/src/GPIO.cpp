@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * @file GPIO.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK GPIO functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/gpio.h>
+#include <hardware/sync.h>
+#include <pico/time.h>
+
+#include "Host.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <array>
+
+namespace
+{
+constexpr size_t PIN_COUNT = 30;
+
+/**
+ * Time a contact stays closed, like a short key press, in microseconds.
+ */
+constexpr uint64_t PRESS_TIME = 100'000;
+
+enum class Pull : uint8_t
+{
+    NONE,
+    UP,
+    DOWN
+};
+
+struct Pin
+{
+    bool output {false};
+    bool level {false};
+    Pull pull {Pull::NONE};
+    uint32_t irq_events {0};
+    bool rising_edge {false};  /* Latched until acknowledged, even while its interrupt is disabled */
+};
+
+struct ClosedContact
+{
+    Host::Contact contact;
+    uint64_t release {0};      /* Time the contact opens in microseconds */
+};
+
+std::mutex mutex;
+std::array<Pin, PIN_COUNT> pins {};
+std::vector<ClosedContact> contacts {};
+gpio_irq_callback_t irq_callback {nullptr};
+
+/**
+ * Opens the contacts whose press is over. The lock must be held.
+ */
+void Release_Contacts() noexcept
+{
+    auto const NOW = time_us_64();
+    std::erase_if(contacts, [NOW](ClosedContact const & closed) {return closed.release <= NOW;});
+}
+
+/**
+ * Runs the handler for every latched rising edge whose interrupt is enabled,
+ * like the interrupt of the first core, which fires again as long as an edge
+ * is latched. The edge is cleared before the handler runs, like the SDK does.
+ */
+void Raise_Edges() noexcept
+{
+    auto raised = false;
+    while (true)
+    {
+        uint pin_index = PIN_COUNT;
+        gpio_irq_callback_t callback {nullptr};
+        {
+            std::lock_guard lock {mutex};
+
+            auto const PIN = std::find_if(pins.begin(), pins.end(), [](Pin const & pin)
+            {
+                return pin.rising_edge && (pin.irq_events & GPIO_IRQ_EDGE_RISE) != 0;
+            });
+            if (PIN == pins.end() || irq_callback == nullptr)
+            {
+                break;
+            }
+            PIN->rising_edge = false;
+            pin_index = static_cast<uint>(PIN - pins.begin());
+            callback = irq_callback;
+        }
+
+        // The handler runs outside the lock, since it reads the pins itself
+        callback(pin_index, GPIO_IRQ_EDGE_RISE);
+        raised = true;
+    }
+
+    if (raised)
+    {
+        __sev();
+    }
+}
+}  // namespace
+
+void gpio_init(uint gpio) noexcept
+{
+    std::lock_guard lock {mutex};
+    pins.at(gpio) = {};
+}
+
+void gpio_set_dir(uint gpio, bool out) noexcept
+{
+    std::lock_guard lock {mutex};
+    pins.at(gpio).output = out;
+}
+
+void gpio_put(uint gpio, bool value) noexcept
+{
+    std::lock_guard lock {mutex};
+
+    // Driving a row high raises the columns of its closed contacts
+    auto & pin = pins.at(gpio);
+    if (value && !pin.level)
+    {
+        Release_Contacts();
+        for (auto const & [CONTACT, RELEASE]: contacts)
+        {
+            if (CONTACT.first == gpio)
+            {
+                pins.at(CONTACT.second).rising_edge = true;
+            }
+        }
+    }
+    pin.level = value;
+}
+
+auto gpio_get(uint gpio) noexcept -> bool
+{
+    std::lock_guard lock {mutex};
+
+    auto const & PIN = pins.at(gpio);
+    if (PIN.output)
+    {
+        return PIN.level;
+    }
+
+    Release_Contacts();
+    auto const IS_CLOSED = std::any_of(contacts.begin(), contacts.end(), [gpio](ClosedContact const & closed)
+    {
+        auto const & OUTPUT = pins.at(closed.contact.first);
+        return closed.contact.second == gpio && OUTPUT.output && OUTPUT.level;
+    });
+    return IS_CLOSED || PIN.pull == Pull::UP;
+}
+
+void gpio_pull_up(uint gpio) noexcept
+{
+    std::lock_guard lock {mutex};
+    pins.at(gpio).pull = Pull::UP;
+}
+
+void gpio_pull_down(uint gpio) noexcept
+{
+    std::lock_guard lock {mutex};
+    pins.at(gpio).pull = Pull::DOWN;
+}
+
+void gpio_set_function(uint gpio, gpio_function function) noexcept
+{
+    std::lock_guard lock {mutex};
+    static_cast<void>(function);
+    pins.at(gpio) = {};
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) noexcept
+{
+    {
+        std::lock_guard lock {mutex};
+
+        auto & events = pins.at(gpio).irq_events;
+        events = enabled ? (events | event_mask) : (events & ~event_mask);
+    }
+
+    // An edge latched while the interrupt was disabled fires as soon as it is enabled
+    if (enabled)
+    {
+        Raise_Edges();
+    }
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled,
+                                        gpio_irq_callback_t callback) noexcept
+{
+    {
+        std::lock_guard lock {mutex};
+        irq_callback = callback;
+    }
+    gpio_set_irq_enabled(gpio, event_mask, enabled);
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask) noexcept
+{
+    std::lock_guard lock {mutex};
+
+    if ((event_mask & GPIO_IRQ_EDGE_RISE) != 0)
+    {
+        pins.at(gpio).rising_edge = false;
+    }
+}
+
+void Host::PressContact(uint output_pin, uint input_pin) noexcept
+{
+    PressContacts({{output_pin, input_pin}});
+}
+
+void Host::PressContacts(std::initializer_list<Contact> new_contacts) noexcept
+{
+    {
+        std::lock_guard lock {mutex};
+
+        auto const RELEASE = time_us_64() + PRESS_TIME;
+        for (auto const & CONTACT: new_contacts)
+        {
+            contacts.push_back({CONTACT, RELEASE});
+
+            auto const & OUTPUT = pins.at(CONTACT.first);
+            if (OUTPUT.output && OUTPUT.level)
+            {
+                pins.at(CONTACT.second).rising_edge = true;
+            }
+        }
+    }
+
+    Raise_Edges();
+}
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ * @file HD44780.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the HD44780 class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "HD44780.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+constexpr uint32_t DEFAULT_BAUD_RATE = 100'000;
+constexpr uint64_t BYTE_BITS_NANOSECONDS = 9 * 1'000'000'000ULL;  // 8 data bits and the acknowledge
+
+auto const START = std::chrono::steady_clock::now();
+}  // namespace
+
+HD44780::HD44780() noexcept
+{
+    ddram.fill(' ');
+    byte_time = static_cast<uint32_t>(BYTE_BITS_NANOSECONDS / DEFAULT_BAUD_RATE);
+}
+
+void HD44780::Start_Transaction(size_t length) noexcept
+{
+    auto const NOW = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - START);
+
+    // The start condition and the address byte come first
+    clock = std::max(clock, static_cast<uint64_t>(NOW.count())) + byte_time;
+    bus_time += byte_time * (length + 1);
+}
+
+auto HD44780::Get_Execution_Time(byte value, bool is_data) noexcept -> uint32_t
+{
+    static constexpr uint32_t INSTRUCTION_TIME = 37'000;
+    static constexpr uint32_t ADDRESS_UPDATE_TIME = 4'000;
+    static constexpr uint32_t SLOW_TIME = 1'520'000;
+    static constexpr byte ENTRY_MODE_SET = 0x04;
+
+    if (is_data)
+    {
+        return INSTRUCTION_TIME + ADDRESS_UPDATE_TIME;
+    }
+
+    // Clearing the display and returning home are the only slow instructions
+    return (value < ENTRY_MODE_SET) ? SLOW_TIME : INSTRUCTION_TIME;
+}
+
+void HD44780::Execute_Instruction(byte instruction) noexcept
+{
+    static constexpr byte CLEAR_DISPLAY = 0x01;
+    static constexpr byte RETURN_HOME = 0x02;
+    static constexpr byte ENTRY_MODE_SET = 0x04;
+    static constexpr byte DISPLAY_CONTROL = 0x08;
+    static constexpr byte FUNCTION_SET = 0x20;
+    static constexpr byte SET_CGRAM_ADDR = 0x40;
+    static constexpr byte SET_DDRAM_ADDR = 0x80;
+    static constexpr byte ENTRY_INCREMENT = 0x02;
+    static constexpr byte DISPLAY_ON = 0x04;
+    static constexpr byte MODE_8_BIT = 0x10;
+
+    if (instruction & SET_DDRAM_ADDR)
+    {
+        address = static_cast<byte>(instruction & (DDRAM_SIZE - 1));
+        cgram_selected = false;
+    }
+    else if (instruction & SET_CGRAM_ADDR)
+    {
+        address = static_cast<byte>(instruction & (CGRAM_SIZE - 1));
+        cgram_selected = true;
+    }
+    else if (instruction & FUNCTION_SET)
+    {
+        four_bit_mode = !(instruction & MODE_8_BIT);
+    }
+    else if (instruction & DISPLAY_CONTROL)
+    {
+        display_on = instruction & DISPLAY_ON;
+        ++version;
+    }
+    else if (instruction & ENTRY_MODE_SET)
+    {
+        increment = instruction & ENTRY_INCREMENT;
+    }
+    else if (instruction & RETURN_HOME)
+    {
+        address = 0;
+        cgram_selected = false;
+    }
+    else if (instruction & CLEAR_DISPLAY)
+    {
+        ddram.fill(' ');
+        address = 0;
+        cgram_selected = false;
+        increment = true;
+        ++version;
+    }
+}
+
+void HD44780::Write_Data(byte data) noexcept
+{
+    auto const SIZE = cgram_selected ? CGRAM_SIZE : DDRAM_SIZE;
+
+    if (cgram_selected)
+    {
+        cgram[address] = data;
+    }
+    else
+    {
+        ddram[address] = data;
+    }
+    address = static_cast<byte>((increment ? address + 1 : address + SIZE - 1) % SIZE);
+    ++version;
+}
+
+void HD44780::Latch(byte port) noexcept
+{
+    static constexpr byte UPPER_NIBBLE = 0xF0;
+
+    auto const NIBBLE = static_cast<byte>(port & UPPER_NIBBLE);
+    auto const IS_DATA = static_cast<bool>(port & REGISTER_SELECT);
+
+    auto value = NIBBLE;
+    if (four_bit_mode)
+    {
+        if (!waiting_low_nibble)
+        {
+            high_nibble = NIBBLE;
+            waiting_low_nibble = true;
+            return;
+        }
+        value = static_cast<byte>(high_nibble | (NIBBLE >> 4));
+    }
+
+    // In 8-bit mode the lower data lines, which are not wired, read as 0
+    waiting_low_nibble = false;
+    busy_until = clock + Get_Execution_Time(value, IS_DATA);
+    ++executions;
+    IS_DATA ? Write_Data(value) : Execute_Instruction(value);
+}
+
+auto HD44780::Write(uint8_t const * data, size_t length) noexcept -> bool
+{
+    std::lock_guard lock {mutex};
+
+    Start_Transaction(length);
+    for (size_t index = 0; index < length; ++index)
+    {
+        auto const PORT = data[index];
+        auto const IS_ENABLE_HIGH = static_cast<bool>(PORT & ENABLE);
+
+        // The expander changes its outputs at the end of the byte
+        clock += byte_time;
+        if (!enable_high && IS_ENABLE_HIGH && !(PORT & READ_WRITE))
+        {
+            auto const SETUP_CHANGED = static_cast<bool>((PORT ^ last_port) & (REGISTER_SELECT | READ_WRITE));
+            if (SETUP_CHANGED || clock < busy_until)
+            {
+                ++timing_violations;
+            }
+        }
+        if (enable_high && !IS_ENABLE_HIGH)
+        {
+            if (last_port & READ_WRITE)
+            {
+                reading_low_nibble = four_bit_mode && !reading_low_nibble;
+            }
+            else
+            {
+                reading_low_nibble = false;
+                Latch(last_port);
+            }
+        }
+        if (static_cast<bool>(PORT & BACKLIGHT) != backlight)
+        {
+            backlight = PORT & BACKLIGHT;
+            ++version;
+        }
+        enable_high = IS_ENABLE_HIGH;
+        last_port = PORT;
+    }
+    return true;
+}
+
+auto HD44780::Read(uint8_t * data, size_t length) noexcept -> bool
+{
+    static constexpr byte BUSY_FLAG = 0x80;
+    static constexpr byte LOWER_LINES = 0x0F;
+
+    std::lock_guard lock {mutex};
+
+    Start_Transaction(length);
+    for (size_t index = 0; index < length; ++index)
+    {
+        clock += byte_time;
+
+        // Outside a read cycle the expander reads back what it drives
+        auto port = last_port;
+        if (enable_high && (last_port & READ_WRITE) && !(last_port & REGISTER_SELECT))
+        {
+            auto const STATUS = static_cast<byte>(((clock < busy_until) ? BUSY_FLAG : 0) | (address & ~BUSY_FLAG));
+            auto const NIBBLE = static_cast<byte>(reading_low_nibble ? (STATUS << 4) : (STATUS & ~LOWER_LINES));
+            port = static_cast<byte>((last_port & LOWER_LINES) | NIBBLE);
+        }
+        data[index] = port;
+    }
+    return true;
+}
+
+void HD44780::SetBusSpeed(uint32_t baud_rate) noexcept
+{
+    std::lock_guard lock {mutex};
+    byte_time = static_cast<uint32_t>(BYTE_BITS_NANOSECONDS / baud_rate);
+}
+
+void HD44780::SetGlyphs(std::string_view custom_glyphs) noexcept
+{
+    std::lock_guard lock {mutex};
+
+    glyphs.fill('?');
+    std::copy_n(custom_glyphs.begin(), std::min(custom_glyphs.size(), glyphs.size()), glyphs.begin());
+    ++version;
+}
+
+auto HD44780::GetLine(byte row) const noexcept -> std::string
+{
+    static constexpr std::array<byte, ROWS> ROW_OFFSETS {0x00, 0x40, 0x14, 0x54};
+
+    std::lock_guard lock {mutex};
+
+    std::string line(COLUMNS, ' ');
+    if (!display_on || row >= ROWS)
+    {
+        return line;
+    }
+    for (byte column = 0; column < COLUMNS; ++column)
+    {
+        auto const CHARACTER = ddram[ROW_OFFSETS[row] + column];
+        line[column] = (CHARACTER < CUSTOM_CHARS) ? glyphs[CHARACTER] : static_cast<char>(CHARACTER);
+    }
+    return line;
+}
+
+auto HD44780::IsBacklightOn() const noexcept -> bool
+{
+    std::lock_guard lock {mutex};
+    return backlight;
+}
+
+auto HD44780::GetVersion() const noexcept -> uint32_t
+{
+    std::lock_guard lock {mutex};
+    return version;
+}
+
+auto HD44780::GetTimingViolations() const noexcept -> uint32_t
+{
+    std::lock_guard lock {mutex};
+    return timing_violations;
+}
+
+auto HD44780::GetBusTime() const noexcept -> uint64_t
+{
+    std::lock_guard lock {mutex};
+    return bus_time;
+}
+
+auto HD44780::GetExecutions() const noexcept -> uint32_t
+{
+    std::lock_guard lock {mutex};
+    return executions;
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * @file I2C.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK I2C functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/i2c.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+
+#include "Host.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <map>
+
+i2c_inst_t host_i2c0_inst {};
+i2c_inst_t host_i2c1_inst {};
+
+namespace
+{
+std::mutex mutex;
+std::map<std::pair<i2c_inst_t const *, uint8_t>, Host::I2CDevice> devices {};
+std::map<std::pair<i2c_inst_t const *, uint8_t>, Host::I2CReader> readers {};
+std::map<std::pair<i2c_inst_t const *, uint8_t>, uint> speeds {};
+std::map<i2c_inst_t const *, std::vector<uint8_t>> tx_fifos {};
+
+/**
+ * Checks if a device acknowledges its address at the speed of the bus. The
+ * mutex must be held.
+ *
+ * @param i2c The I2C instance
+ * @param address The 7-bit device address
+ * @return True or False
+ */
+auto Is_Acknowledged(i2c_inst_t const * i2c, uint8_t address) noexcept -> bool
+{
+    if (devices.find({i2c, address}) == devices.end())
+    {
+        return false;
+    }
+
+    auto const SPEED = speeds.find({i2c, address});
+    return SPEED == speeds.end() || i2c->baudrate <= SPEED->second;
+}
+}  // namespace
+
+auto i2c_init(i2c_inst_t * i2c, uint baudrate) noexcept -> uint
+{
+    return i2c_set_baudrate(i2c, baudrate);
+}
+
+auto i2c_set_baudrate(i2c_inst_t * i2c, uint baudrate) noexcept -> uint
+{
+    i2c->baudrate = baudrate;
+    return baudrate;
+}
+
+auto i2c_write_blocking(i2c_inst_t * i2c, uint8_t addr, uint8_t const * src, size_t len, bool nostop) noexcept -> int
+{
+    static_cast<void>(nostop);
+
+    std::lock_guard lock {mutex};
+    if (!Is_Acknowledged(i2c, addr) || !devices.at({i2c, addr})(src, len))
+    {
+        return PICO_ERROR_GENERIC;
+    }
+    return static_cast<int>(len);
+}
+
+auto i2c_get_hw(i2c_inst_t * i2c) noexcept -> i2c_hw_t *
+{
+    return &i2c->hw;
+}
+
+auto i2c_hw_index(i2c_inst_t * i2c) noexcept -> uint
+{
+    return (i2c == i2c0) ? 0 : 1;
+}
+
+auto i2c_get_dreq(i2c_inst_t * i2c, bool is_tx) noexcept -> uint
+{
+    auto const BASE = (i2c == i2c0) ? DREQ_I2C0_TX : DREQ_I2C1_TX;
+    return static_cast<uint>(is_tx ? BASE : BASE + 1);
+}
+
+auto i2c_read_blocking(i2c_inst_t * i2c, uint8_t addr, uint8_t * dst, size_t len, bool nostop) noexcept -> int
+{
+    static_cast<void>(nostop);
+
+    std::lock_guard lock {mutex};
+    if (!Is_Acknowledged(i2c, addr))
+    {
+        return PICO_ERROR_GENERIC;
+    }
+
+    auto const READER = readers.find({i2c, addr});
+    if (READER == readers.end() || !READER->second)
+    {
+        std::fill(dst, dst + len, uint8_t {0});
+        return static_cast<int>(len);
+    }
+    return READER->second(dst, len) ? static_cast<int>(len) : PICO_ERROR_GENERIC;
+}
+
+void Host::WriteI2CDataCommand(i2c_inst_t * i2c, uint32_t data_cmd) noexcept
+{
+    static constexpr uint32_t DATA_MASK = 0xFF;
+
+    {
+        std::lock_guard lock {mutex};
+        auto & fifo = tx_fifos[i2c];
+        fifo.push_back(static_cast<uint8_t>(data_cmd & DATA_MASK));
+        if (!(data_cmd & I2C_IC_DATA_CMD_STOP_BITS))
+        {
+            i2c->hw.status = I2C_IC_STATUS_ACTIVITY_BITS;
+            return;
+        }
+
+        // A device that does not acknowledge its address aborts the transfer, which is dropped like on the bus
+        auto const ADDRESS = static_cast<uint8_t>(i2c->hw.tar);
+        auto const ACKNOWLEDGED = Is_Acknowledged(i2c, ADDRESS);
+        if (ACKNOWLEDGED)
+        {
+            devices.at({i2c, ADDRESS})(fifo.data(), fifo.size());
+        }
+        fifo.clear();
+
+        // The STOP is on the bus and the FIFO is empty
+        i2c->hw.tx_abrt_source = ACKNOWLEDGED ? 0 : I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS;
+        i2c->hw.raw_intr_stat = I2C_IC_RAW_INTR_STAT_STOP_DET_BITS | (ACKNOWLEDGED ? 0 : I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS);
+        i2c->hw.status = I2C_IC_STATUS_TFE_BITS;
+        if (!(i2c->hw.raw_intr_stat & i2c->hw.intr_mask))
+        {
+            return;
+        }
+    }
+    Host::RaiseInterrupt(I2C0_IRQ + i2c_hw_index(i2c));
+}
+
+void Host::AttachI2CDevice(i2c_inst_t * i2c, uint8_t address, I2CDevice device, I2CReader reader) noexcept
+{
+    std::lock_guard lock {mutex};
+    devices[{i2c, address}] = std::move(device);
+    readers[{i2c, address}] = std::move(reader);
+}
+
+void Host::SetI2CDeviceSpeed(i2c_inst_t * i2c, uint8_t address, uint baud_rate) noexcept
+{
+    std::lock_guard lock {mutex};
+    speeds[{i2c, address}] = baud_rate;
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * @file IRQ.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK interrupt functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/irq.h>
+
+#include "Host.hpp"
+
+#include <mutex>
+#include <array>
+
+namespace
+{
+constexpr uint INTERRUPTS = 32;
+
+struct Interrupt
+{
+    irq_handler_t handler {nullptr};
+    bool enabled {false};
+    bool pending {false};
+};
+
+std::mutex mutex;
+std::array<Interrupt, INTERRUPTS> interrupts {};
+}  // namespace
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) noexcept
+{
+    std::lock_guard lock {mutex};
+    interrupts.at(num).handler = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled) noexcept
+{
+    irq_handler_t handler {nullptr};
+
+    {
+        std::lock_guard lock {mutex};
+        auto & interrupt = interrupts.at(num);
+        interrupt.enabled = enabled;
+        if (enabled && interrupt.pending)
+        {
+            interrupt.pending = false;
+            handler = interrupt.handler;
+        }
+    }
+    if (handler != nullptr)
+    {
+        handler();
+    }
+}
+
+void Host::RaiseInterrupt(uint num) noexcept
+{
+    irq_handler_t handler {nullptr};
+
+    {
+        std::lock_guard lock {mutex};
+        auto & interrupt = interrupts.at(num);
+        if (!interrupt.enabled || interrupt.handler == nullptr)
+        {
+            interrupt.pending = true;
+            return;
+        }
+        handler = interrupt.handler;
+    }
+    handler();
+}
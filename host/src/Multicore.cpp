@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * @file Multicore.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK multicore functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/sync.h>
+#include <pico/multicore.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <array>
+
+namespace
+{
+/**
+ * Bounded queue with the same depth as the RP2040 inter-core FIFOs.
+ */
+class Fifo final
+{
+ private:
+
+    static constexpr size_t DEPTH = 8;
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::array<uint32_t, DEPTH> values {};
+    size_t head {0};
+    size_t count {0};
+
+ public:
+
+    void Push(uint32_t value) noexcept
+    {
+        std::unique_lock lock {mutex};
+        changed.wait(lock, [this] {return count < DEPTH;});
+        values[(head + count) % DEPTH] = value;
+        ++count;
+        changed.notify_all();
+    }
+
+    auto Pop() noexcept -> uint32_t
+    {
+        std::unique_lock lock {mutex};
+        changed.wait(lock, [this] {return count > 0;});
+        auto const VALUE = values[head];
+        head = (head + 1) % DEPTH;
+        --count;
+        changed.notify_all();
+        return VALUE;
+    }
+
+    auto HasData() noexcept -> bool
+    {
+        std::lock_guard lock {mutex};
+        return count > 0;
+    }
+
+    auto HasSpace() noexcept -> bool
+    {
+        std::lock_guard lock {mutex};
+        return count < DEPTH;
+    }
+};
+
+std::array<Fifo, 2> fifos {};  // Indexed by the reading core
+
+thread_local uint core_number {0};
+}  // namespace
+
+void multicore_launch_core1(void (* entry)()) noexcept
+{
+    std::thread {[entry]
+    {
+        core_number = 1;
+        entry();
+    }}.detach();
+}
+
+void multicore_fifo_push_blocking(uint32_t data) noexcept
+{
+    fifos[1 - core_number].Push(data);
+    __sev();
+}
+
+auto multicore_fifo_pop_blocking() noexcept -> uint32_t
+{
+    return fifos[core_number].Pop();
+}
+
+auto multicore_fifo_rvalid() noexcept -> bool
+{
+    return fifos[core_number].HasData();
+}
+
+auto multicore_fifo_wready() noexcept -> bool
+{
+    return fifos[1 - core_number].HasSpace();
+}
+
+auto get_core_num() noexcept -> uint
+{
+    return core_number;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * @file PIO.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK PIO functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/pio.h>
+
+#include "Host.hpp"
+
+#include <utility>
+#include <mutex>
+#include <map>
+
+pio_hw_t host_pio0_hw {};
+pio_hw_t host_pio1_hw {};
+
+namespace
+{
+constexpr uint STATE_MACHINES = 4;
+
+std::mutex mutex;
+std::map<pio_hw_t const *, Host::PIODevice> devices {};
+}  // namespace
+
+auto pio_get_default_sm_config() noexcept -> pio_sm_config
+{
+    return {};
+}
+
+void pio_gpio_init(PIO pio, uint pin) noexcept
+{
+    static_cast<void>(pio);
+    static_cast<void>(pin);
+}
+
+auto pio_claim_unused_sm(PIO pio, bool required) noexcept -> int
+{
+    static_cast<void>(required);
+
+    std::lock_guard lock {mutex};
+    for (uint sm = 0; sm < STATE_MACHINES; ++sm)
+    {
+        if (!((pio->claimed_state_machines >> sm) & 1U))
+        {
+            pio->claimed_state_machines = static_cast<uint8_t>(pio->claimed_state_machines | (1U << sm));
+            return static_cast<int>(sm);
+        }
+    }
+    return -1;
+}
+
+auto pio_add_program(PIO pio, pio_program_t const * program) noexcept -> uint
+{
+    std::lock_guard lock {mutex};
+    auto const OFFSET = pio->used_instructions;
+    pio->used_instructions = static_cast<uint8_t>(pio->used_instructions + program->length);
+    return OFFSET;
+}
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, pio_sm_config const * config) noexcept
+{
+    static_cast<void>(pio);
+    static_cast<void>(sm);
+    static_cast<void>(initial_pc);
+    static_cast<void>(config);
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) noexcept
+{
+    static_cast<void>(pio);
+    static_cast<void>(sm);
+    static_cast<void>(enabled);
+}
+
+void pio_sm_set_pins_with_mask(PIO pio, uint sm, uint32_t pin_values, uint32_t pin_mask) noexcept
+{
+    static_cast<void>(pio);
+    static_cast<void>(sm);
+    static_cast<void>(pin_values);
+    static_cast<void>(pin_mask);
+}
+
+void pio_sm_set_pindirs_with_mask(PIO pio, uint sm, uint32_t pin_dirs, uint32_t pin_mask) noexcept
+{
+    static_cast<void>(pio);
+    static_cast<void>(sm);
+    static_cast<void>(pin_dirs);
+    static_cast<void>(pin_mask);
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) noexcept
+{
+    static_cast<void>(sm);
+
+    std::lock_guard lock {mutex};
+    auto const DEVICE = devices.find(pio);
+    if (DEVICE != devices.end())
+    {
+        DEVICE->second(data);
+    }
+}
+
+void sm_config_set_sideset_pins(pio_sm_config * config, uint sideset_base) noexcept
+{
+    static_cast<void>(config);
+    static_cast<void>(sideset_base);
+}
+
+void sm_config_set_out_pins(pio_sm_config * config, uint out_base, uint out_count) noexcept
+{
+    static_cast<void>(config);
+    static_cast<void>(out_base);
+    static_cast<void>(out_count);
+}
+
+void sm_config_set_set_pins(pio_sm_config * config, uint set_base, uint set_count) noexcept
+{
+    static_cast<void>(config);
+    static_cast<void>(set_base);
+    static_cast<void>(set_count);
+}
+
+void sm_config_set_out_shift(pio_sm_config * config, bool shift_right, bool autopull, uint pull_threshold) noexcept
+{
+    static_cast<void>(config);
+    static_cast<void>(shift_right);
+    static_cast<void>(autopull);
+    static_cast<void>(pull_threshold);
+}
+
+void sm_config_set_clkdiv(pio_sm_config * config, float div) noexcept
+{
+    static_cast<void>(config);
+    static_cast<void>(div);
+}
+
+void Host::AttachPIODevice(PIO pio, PIODevice device) noexcept
+{
+    std::lock_guard lock {mutex};
+    devices[pio] = std::move(device);
+}
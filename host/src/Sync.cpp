@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * @file Sync.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK synchronisation primitives.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <pico/multicore.h>
+#include <pico/sync.h>
+
+#include <condition_variable>
+#include <chrono>
+#include <mutex>
+#include <array>
+
+namespace
+{
+/**
+ * Upper bound of a wait for an event, standing in for the interrupts that
+ * are not emulated and would also wake the core.
+ */
+constexpr auto MAX_EVENT_WAIT = std::chrono::milliseconds(10);
+
+std::mutex event_mutex;
+std::condition_variable event_signalled;
+std::array<bool, 2> event_pending {};  // Indexed by the core
+}  // namespace
+
+void critical_section_init(critical_section_t * crit_sec) noexcept
+{
+    static_cast<void>(crit_sec);
+}
+
+void critical_section_enter_blocking(critical_section_t * crit_sec) noexcept
+{
+    crit_sec->mutex.lock();
+}
+
+void critical_section_exit(critical_section_t * crit_sec) noexcept
+{
+    crit_sec->mutex.unlock();
+}
+
+void __sev() noexcept
+{
+    {
+        std::lock_guard lock {event_mutex};
+        event_pending.fill(true);
+    }
+    event_signalled.notify_all();
+}
+
+void __wfe() noexcept
+{
+    auto const CORE = get_core_num();
+
+    std::unique_lock lock {event_mutex};
+    event_signalled.wait_for(lock, MAX_EVENT_WAIT, [CORE] {return event_pending[CORE];});
+    event_pending[CORE] = false;
+}
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * @file TM1637Display.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the TM1637Display class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "TM1637Display.hpp"
+
+#include <algorithm>
+
+void TM1637Display::Transfer(byte command, byte const * data, size_t length) noexcept
+{
+    if ((command & COMMAND_MASK) == ADDRESS_COMMAND)
+    {
+        address = static_cast<byte>(command & ~COMMAND_MASK);
+    }
+    else if ((command & COMMAND_MASK) == DISPLAY_CONTROL)
+    {
+        display_on = command & DISPLAY_ON;
+        brightness = static_cast<byte>(command & BRIGHTNESS_MASK);
+        ++version;
+    }
+
+    for (size_t index = 0; index < length; ++index, ++address)
+    {
+        if (address < DIGITS && segments[address] != data[index])
+        {
+            segments[address] = data[index];
+            ++version;
+        }
+    }
+}
+
+auto TM1637Display::Segments_To_Char(byte digit_segments) noexcept -> char
+{
+    static constexpr std::array<byte, 16> DIGIT_SEGMENTS {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+                                                          0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71};
+    static constexpr char const * DIGIT_CHARS = "0123456789ABCDEF";
+    static constexpr byte MINUS = 0x40;
+
+    auto const SEGMENTS = static_cast<byte>(digit_segments & ~COLON);
+    auto const DIGIT = std::find(DIGIT_SEGMENTS.begin(), DIGIT_SEGMENTS.end(), SEGMENTS);
+
+    if (DIGIT != DIGIT_SEGMENTS.end())
+    {
+        return DIGIT_CHARS[DIGIT - DIGIT_SEGMENTS.begin()];
+    }
+    return (SEGMENTS == MINUS) ? '-' : ' ';
+}
+
+void TM1637Display::Write(uint32_t word) noexcept
+{
+    std::array<byte, sizeof(word)> bytes {};
+
+    for (size_t index = 0; index < bytes.size(); ++index)
+    {
+        bytes[index] = static_cast<byte>(word >> (index * BYTE_SIZE));
+    }
+
+    std::lock_guard lock {mutex};
+    Transfer(bytes[0], nullptr, 0);
+    Transfer(bytes[1], bytes.data() + 2, 2);
+}
+
+auto TM1637Display::GetText() const noexcept -> std::string
+{
+    std::lock_guard lock {mutex};
+
+    std::string text {};
+    if (!display_on)
+    {
+        return std::string(DIGITS, ' ');
+    }
+    for (byte digit = 0; digit < DIGITS; ++digit)
+    {
+        text += Segments_To_Char(segments[digit]);
+        if (digit == 1)
+        {
+            text += (segments[digit] & COLON) ? ':' : ' ';
+        }
+    }
+    return text;
+}
+
+auto TM1637Display::GetBrightness() const noexcept -> byte
+{
+    std::lock_guard lock {mutex};
+    return brightness;
+}
+
+auto TM1637Display::GetVersion() const noexcept -> uint32_t
+{
+    std::lock_guard lock {mutex};
+    return version;
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * @file Time.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Host implementation of the Pico SDK time functions.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include <hardware/sync.h>
+#include <pico/time.h>
+
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+namespace
+{
+auto const BOOT_TIME = std::chrono::steady_clock::now();
+std::atomic<alarm_id_t> next_alarm {1};
+}  // namespace
+
+auto get_absolute_time() noexcept -> absolute_time_t
+{
+    return time_us_64();
+}
+
+auto to_ms_since_boot(absolute_time_t time) noexcept -> uint32_t
+{
+    return static_cast<uint32_t>(time / 1'000);
+}
+
+auto to_us_since_boot(absolute_time_t time) noexcept -> uint64_t
+{
+    return time;
+}
+
+auto time_us_64() noexcept -> uint64_t
+{
+    auto const ELAPSED = std::chrono::steady_clock::now() - BOOT_TIME;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(ELAPSED).count());
+}
+
+auto time_us_32() noexcept -> uint32_t
+{
+    return static_cast<uint32_t>(time_us_64());
+}
+
+void sleep_us(uint64_t us) noexcept
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void busy_wait_us_32(uint32_t delay_us) noexcept
+{
+    auto const TARGET = time_us_64() + delay_us;
+    while (time_us_64() < TARGET) {}
+}
+
+void sleep_ms(uint32_t ms) noexcept
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void sleep_until(absolute_time_t target) noexcept
+{
+    std::this_thread::sleep_until(BOOT_TIME + std::chrono::microseconds(target));
+}
+
+auto add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void * user_data,
+                     bool fire_if_past) noexcept -> alarm_id_t
+{
+    static_cast<void>(fire_if_past);
+
+    auto const ALARM = next_alarm.fetch_add(1);
+    std::thread {[=]
+    {
+        auto delay = static_cast<int64_t>(ms) * 1'000;
+        while (delay != 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(std::abs(delay)));
+            delay = callback(ALARM, user_data);
+
+            // Like an interrupt, it wakes up a core waiting for an event
+            __sev();
+        }
+    }}.detach();
+    return ALARM;
+}
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * @file main.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Entry point of the host build. The game runs unchanged against the
+ *        emulated peripherals, which are drawn on the terminal, while the keys
+ *        typed on the standard input are pressed on the emulated keypad.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "TM1637Display.hpp"
+#include "HD44780.hpp"
+#include "Keypad.hpp"
+#include "Host.hpp"
+#include "Game.hpp"
+
+#include <string_view>
+#include <cstdlib>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+namespace
+{
+/**
+ * Redraws the emulated peripherals on the terminal whenever they change.
+ *
+ * @param lcd_screen The emulated LCD screen
+ * @param scoreboard The emulated scoreboard
+ */
+[[noreturn]] void Render(HD44780 const & lcd_screen, TM1637Display const & scoreboard) noexcept
+{
+    static constexpr uint32_t REFRESH_PERIOD = 100;
+
+    uint64_t last_version {UINT64_MAX};
+
+    while (true)
+    {
+        auto const VERSION = (uint64_t {lcd_screen.GetVersion()} << 32U) | scoreboard.GetVersion();
+        if (VERSION != last_version)
+        {
+            last_version = VERSION;
+
+            std::printf("\033[2J\033[H+--------------------+  Score %s  Brightness %u\n",
+                        scoreboard.GetText().c_str(), static_cast<unsigned>(scoreboard.GetBrightness()));
+            for (uint8_t row = 0; row < HD44780::ROWS; ++row)
+            {
+                std::printf("|%s|\n", lcd_screen.GetLine(row).c_str());
+            }
+            std::printf("+--------------------+  Backlight %s\n\n", lcd_screen.IsBacklightOn() ? "on" : "off");
+            std::printf("Keys: 1-9 board, a-d difficulty, # and d choices, d move now, * backlight, 0 brightness, "
+                        "p profile\n");
+            std::fflush(stdout);
+        }
+        sleep_ms(REFRESH_PERIOD);
+    }
+}
+}  // namespace
+
+int main()
+{
+    constexpr auto I2C = PICO_DEFAULT_I2C_INSTANCE;
+    constexpr auto SDA = PICO_DEFAULT_I2C_SDA_PIN;
+    constexpr auto SCL = PICO_DEFAULT_I2C_SCL_PIN;
+    constexpr auto I2C_ADDRESS = 0x27;
+    constexpr auto LCD_COLUMNS = 20;
+    constexpr auto LCD_ROWS = 4;
+    constexpr auto LCD_BUS_SPEED = 400'000; /* Like most PCF8574 modules, fast mode but not fast mode plus */
+    constexpr auto DIO = 27;
+    constexpr auto CLK = 28;
+    constexpr Keypad::array KEYPAD_ROWS {10, 11, 12, 13};
+    constexpr Keypad::array KEYPAD_COLUMNS {18, 19, 20, 21};
+    constexpr std::string_view KEY_CHARS {"123a456b789c*0#d"};
+    constexpr std::string_view PROFILER_CHORD {"*#"};
+    constexpr char PROFILER_CHORD_CHAR = 'p';
+    auto * pio = pio0;
+
+    static HD44780 lcd_screen {};
+    static TM1637Display scoreboard {};
+
+    lcd_screen.SetGlyphs("[|]XO ");
+    Host::AttachI2CDevice(I2C, I2C_ADDRESS, [](uint8_t const * data, size_t length)
+    {
+        return lcd_screen.Write(data, length);
+    }, [](uint8_t * data, size_t length)
+    {
+        return lcd_screen.Read(data, length);
+    });
+    Host::SetI2CDeviceSpeed(I2C, I2C_ADDRESS, LCD_BUS_SPEED);
+    Host::AttachPIODevice(pio, [](uint32_t word) {scoreboard.Write(word);});
+
+    std::thread {Render, std::cref(lcd_screen), std::cref(scoreboard)}.detach();
+    std::thread {[=]
+    {
+        Profiler::Init();
+
+        static I2CBus bus {I2C, SDA, SCL};
+        bus.AddDevice(I2C_ADDRESS, LCD_I2C::MAX_BUS_SPEED);
+        bus.Probe();
+        lcd_screen.SetBusSpeed(bus.GetBaudRate());
+
+        auto game = std::make_unique<Game>(
+                new LCD_I2C {&bus, I2C_ADDRESS, LCD_COLUMNS, LCD_ROWS},
+                new TM1637 {DIO, CLK, pio},
+                new Keypad {KEYPAD_ROWS, KEYPAD_COLUMNS});
+
+        game->Play();
+    }}.detach();
+
+    // The keypad reverses its pins, so the key at (row, column) closes the
+    // contact between the mirrored row and column pins
+    auto const CONTACT = [&](size_t key_index) -> Host::Contact
+    {
+        auto const SIZE = KEYPAD_ROWS.size();
+        return {KEYPAD_ROWS[SIZE - 1 - key_index / SIZE], KEYPAD_COLUMNS[SIZE - 1 - key_index % SIZE]};
+    };
+
+    for (int character = std::getchar(); character != EOF; character = std::getchar())
+    {
+        if (character == PROFILER_CHORD_CHAR)
+        {
+            // Both keys are held before the interrupt of the first one is raised
+            Host::PressContacts({CONTACT(KEY_CHARS.find(PROFILER_CHORD[0])),
+                                 CONTACT(KEY_CHARS.find(PROFILER_CHORD[1]))});
+        }
+        else if (auto const KEY_INDEX = KEY_CHARS.find(static_cast<char>(character));
+                KEY_INDEX != std::string_view::npos)
+        {
+            auto const [ROW, COLUMN] = CONTACT(KEY_INDEX);
+            Host::PressContact(ROW, COLUMN);
+        }
+    }
+    std::quick_exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,395 @@
+/*******************************************************************************
+ * @file BitBoard.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the BitBoard class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "Utility.hpp"
+#include "Move.hpp"
+
+#include <cstdint>
+#include <array>
+#include <bit>
+
+/**
+ * Packed representation of the game board used in the search hot path. The
+ * pieces of each player are kept as a 9-bit occupancy mask (one bit per cell,
+ * row-major order) and both masks are stored in a single word, so copying,
+ * making and unmaking a move are all O(1).
+ */
+class BitBoard final
+{
+ public:
+
+    using mask = uint16_t;
+    using word = uint32_t;
+    using key = uint16_t;
+
+    static constexpr uint8_t CELLS = Utility::BOARD_SIZE * Utility::BOARD_SIZE;
+    static constexpr mask FULL_MASK = (1U << CELLS) - 1;
+
+    /**
+     * Number of distinct keys, i.e. 3 ^ CELLS.
+     */
+    static constexpr key KEY_COUNT = 19'683;
+
+ private:
+
+    static constexpr uint8_t O_SHIFT = 16;
+
+    /**
+     * Computes the base-3 value of every 9-bit mask read as a number whose
+     * digits are only 0 and 1.
+     *
+     * @return The lookup table
+     */
+    static constexpr auto Make_Base_3_Table() noexcept -> std::array<key, FULL_MASK + 1>;
+
+    static const std::array<key, FULL_MASK + 1> BASE_3;
+
+    static constexpr std::array<mask, 8> WIN_LINES {0b000'000'111, /* First row */
+                                                    0b000'111'000, /* Second row */
+                                                    0b111'000'000, /* Third row */
+                                                    0b001'001'001, /* First column */
+                                                    0b010'010'010, /* Second column */
+                                                    0b100'100'100, /* Third column */
+                                                    0b100'010'001, /* Main diagonal */
+                                                    0b001'010'100  /* Anti-diagonal */};
+
+    word pieces {0};
+
+ public:
+
+    /**
+     * [Constructor] Creates an empty board.
+     */
+    constexpr BitBoard() noexcept = default;
+
+    /**
+     * [Constructor] Packs a regular board.
+     *
+     * @param board The board to be packed
+     */
+    explicit constexpr BitBoard(Utility::Board const & board) noexcept;
+
+    /**
+     * [Constructor] Creates a board from the occupancy masks of the players.
+     *
+     * @param x_mask The cells occupied by X
+     * @param o_mask The cells occupied by O
+     */
+    constexpr BitBoard(mask x_mask, mask o_mask) noexcept;
+
+    /**
+     * Gets the occupancy mask of a player.
+     *
+     * @param player The player
+     * @return The cells occupied by the player
+     */
+    [[nodiscard]] constexpr auto GetMask(Utility::PlayerSymbol player) const noexcept -> mask;
+
+    /**
+     * Gets the occupancy mask of both players.
+     *
+     * @return The occupied cells
+     */
+    [[nodiscard]] constexpr auto GetOccupied() const noexcept -> mask;
+
+    /**
+     * Gets the mask of the empty cells, i.e. the available moves.
+     *
+     * @return The empty cells
+     */
+    [[nodiscard]] constexpr auto GetEmpty() const noexcept -> mask;
+
+    /**
+     * Gets the piece found on a cell.
+     *
+     * @param cell The cell index
+     * @return The piece
+     */
+    [[nodiscard]] constexpr auto GetCell(uint8_t cell) const noexcept -> Utility::PlayerSymbol;
+
+    /**
+     * Computes the number of pieces on the board.
+     *
+     * @return The number of pieces
+     */
+    [[nodiscard]] constexpr auto GetMoveCount() const noexcept -> uint8_t;
+
+    /**
+     * Computes the current player based on the number of pieces on the board.
+     *
+     * @return The current player
+     */
+    [[nodiscard]] constexpr auto GetCurrentPlayer() const noexcept -> Utility::PlayerSymbol;
+
+    /**
+     * Checks if the player has a winning configuration on the board.
+     *
+     * @param player The player
+     * @return True or False
+     */
+    [[nodiscard]] constexpr auto IsWinner(Utility::PlayerSymbol player) const noexcept -> bool;
+
+    /**
+     * Checks if the board is full with pieces.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] constexpr auto IsFull() const noexcept -> bool;
+
+    /**
+     * Checks if the board configuration is terminal.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] constexpr auto IsTerminal() const noexcept -> bool;
+
+    /**
+     * Gets the score for a terminal board.
+     *
+     * @return The board score
+     */
+    [[nodiscard]] constexpr auto GetValue() const noexcept -> Utility::Value;
+
+    /**
+     * Computes the base-3 index of the board (0 for an empty cell, 1 for X
+     * and 2 for O, with the first cell as the least significant digit). It is
+     * unique for every board and lower than KEY_COUNT.
+     *
+     * @return The board key
+     */
+    [[nodiscard]] constexpr auto GetKey() const noexcept -> key;
+
+    /**
+     * Rebuilds the board that has a given base-3 index.
+     *
+     * @param board_key The board key, lower than KEY_COUNT
+     * @return The board
+     */
+    [[nodiscard]] static constexpr auto FromKey(key board_key) noexcept -> BitBoard;
+
+    /**
+     * Places a piece on an empty cell.
+     *
+     * @param cell The cell index
+     * @param player The player making the move
+     */
+    constexpr void MakeMove(uint8_t cell, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Removes the piece from a cell.
+     *
+     * @param cell The cell index
+     */
+    constexpr void UnmakeMove(uint8_t cell) noexcept;
+
+    /**
+     * Unpacks the board to its regular representation.
+     *
+     * @return The regular board
+     */
+    [[nodiscard]] constexpr auto ToBoard() const noexcept -> Utility::Board;
+
+    /**
+     * Converts a move to its cell index.
+     *
+     * @param action The move
+     * @return The cell index
+     */
+    [[nodiscard]] static auto CellFromMove(Move const & action) noexcept -> uint8_t;
+
+    /**
+     * Converts a cell index to its move.
+     *
+     * @param cell The cell index
+     * @return The move
+     */
+    [[nodiscard]] static auto MoveFromCell(uint8_t cell) noexcept -> Move;
+
+    /**
+     * [Equality operator] Checks if the boards are the same.
+     */
+    friend constexpr auto operator==(BitBoard const & lhs, BitBoard const & rhs) noexcept -> bool = default;
+};
+
+constexpr auto BitBoard::Make_Base_3_Table() noexcept -> std::array<key, FULL_MASK + 1>
+{
+    std::array<key, FULL_MASK + 1> table {};
+
+    for (word value = 0; value <= FULL_MASK; ++value)
+    {
+        key power = 1;
+        for (uint8_t cell = 0; cell < CELLS; ++cell)
+        {
+            if ((value >> cell) & 1U)
+            {
+                table[value] = static_cast<key>(table[value] + power);
+            }
+            power = static_cast<key>(power * 3);
+        }
+    }
+    return table;
+}
+
+inline constexpr std::array<BitBoard::key, BitBoard::FULL_MASK + 1> BitBoard::BASE_3 = Make_Base_3_Table();
+
+constexpr BitBoard::BitBoard(Utility::Board const & board) noexcept
+{
+    #pragma GCC unroll 9
+    for (uint8_t cell = 0; cell < CELLS; ++cell)
+    {
+        auto const SYMBOL = board[cell / Utility::BOARD_SIZE][cell % Utility::BOARD_SIZE];
+        if (SYMBOL != Utility::PlayerSymbol::UNK)
+        {
+            MakeMove(cell, SYMBOL);
+        }
+    }
+}
+
+constexpr BitBoard::BitBoard(mask x_mask, mask o_mask) noexcept
+        : pieces((word {x_mask} & FULL_MASK) | ((word {o_mask} & FULL_MASK) << O_SHIFT)) {}
+
+constexpr auto BitBoard::GetMask(Utility::PlayerSymbol player) const noexcept -> mask
+{
+    switch (player)
+    {
+        case Utility::PlayerSymbol::X:
+            return static_cast<mask>(pieces & FULL_MASK);
+        case Utility::PlayerSymbol::O:
+            return static_cast<mask>((pieces >> O_SHIFT) & FULL_MASK);
+        default:
+            return 0;
+    }
+}
+
+constexpr auto BitBoard::GetOccupied() const noexcept -> mask
+{
+    return static_cast<mask>((pieces | (pieces >> O_SHIFT)) & FULL_MASK);
+}
+
+constexpr auto BitBoard::GetEmpty() const noexcept -> mask
+{
+    return static_cast<mask>(~GetOccupied() & FULL_MASK);
+}
+
+constexpr auto BitBoard::GetCell(uint8_t cell) const noexcept -> Utility::PlayerSymbol
+{
+    if ((pieces >> cell) & 1U)
+    {
+        return Utility::PlayerSymbol::X;
+    }
+    if ((pieces >> (cell + O_SHIFT)) & 1U)
+    {
+        return Utility::PlayerSymbol::O;
+    }
+    return Utility::PlayerSymbol::UNK;
+}
+
+constexpr auto BitBoard::GetMoveCount() const noexcept -> uint8_t
+{
+    return static_cast<uint8_t>(std::popcount(pieces));
+}
+
+constexpr auto BitBoard::GetCurrentPlayer() const noexcept -> Utility::PlayerSymbol
+{
+    return (GetMoveCount() % 2 == 0) ? Utility::PlayerSymbol::X : Utility::PlayerSymbol::O;
+}
+
+constexpr auto BitBoard::IsWinner(Utility::PlayerSymbol player) const noexcept -> bool
+{
+    auto const PLAYER_MASK = GetMask(player);
+
+    #pragma GCC unroll 8
+    for (mask const LINE: WIN_LINES)
+    {
+        if ((PLAYER_MASK & LINE) == LINE)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr auto BitBoard::IsFull() const noexcept -> bool
+{
+    return GetOccupied() == FULL_MASK;
+}
+
+constexpr auto BitBoard::IsTerminal() const noexcept -> bool
+{
+    return IsFull() || IsWinner(Utility::PlayerSymbol::X) || IsWinner(Utility::PlayerSymbol::O);
+}
+
+constexpr auto BitBoard::GetValue() const noexcept -> Utility::Value
+{
+    if (IsWinner(Utility::PlayerSymbol::X))
+    {
+        return 1;
+    }
+    if (IsWinner(Utility::PlayerSymbol::O))
+    {
+        return -1;
+    }
+    return 0;
+}
+
+constexpr auto BitBoard::GetKey() const noexcept -> key
+{
+    return static_cast<key>(BASE_3[GetMask(Utility::PlayerSymbol::X)] + 2 * BASE_3[GetMask(Utility::PlayerSymbol::O)]);
+}
+
+constexpr auto BitBoard::FromKey(key board_key) noexcept -> BitBoard
+{
+    mask x_mask = 0;
+    mask o_mask = 0;
+
+    #pragma GCC unroll 9
+    for (uint8_t cell = 0; cell < CELLS; ++cell)
+    {
+        auto const DIGIT = static_cast<mask>(board_key % 3);
+
+        x_mask = static_cast<mask>(x_mask | ((DIGIT & 1U) << cell));
+        o_mask = static_cast<mask>(o_mask | ((DIGIT >> 1U) << cell));
+        board_key = static_cast<key>(board_key / 3);
+    }
+    return {x_mask, o_mask};
+}
+
+constexpr void BitBoard::MakeMove(uint8_t cell, Utility::PlayerSymbol player) noexcept
+{
+    pieces |= (player == Utility::PlayerSymbol::X) ? (word {1} << cell) : (word {1} << (cell + O_SHIFT));
+}
+
+constexpr void BitBoard::UnmakeMove(uint8_t cell) noexcept
+{
+    pieces &= ~((word {1} << cell) | (word {1} << (cell + O_SHIFT)));
+}
+
+constexpr auto BitBoard::ToBoard() const noexcept -> Utility::Board
+{
+    Utility::Board board {};
+
+    #pragma GCC unroll 9
+    for (uint8_t cell = 0; cell < CELLS; ++cell)
+    {
+        board[cell / Utility::BOARD_SIZE][cell % Utility::BOARD_SIZE] = GetCell(cell);
+    }
+    return board;
+}
+
+inline auto BitBoard::CellFromMove(Move const & action) noexcept -> uint8_t
+{
+    return static_cast<uint8_t>(action.GetRow() * Utility::BOARD_SIZE + action.GetColumn());
+}
+
+inline auto BitBoard::MoveFromCell(uint8_t cell) noexcept -> Move
+{
+    return {static_cast<int8_t>(cell / Utility::BOARD_SIZE), static_cast<int8_t>(cell % Utility::BOARD_SIZE)};
+}
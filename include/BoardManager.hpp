@@ -9,19 +9,57 @@
 
 #pragma once
 
+#include "MoveList.hpp"
+#include "BitBoard.hpp"
 #include "Utility.hpp"
 #include "Move.hpp"
 
+#include <algorithm>
 #include <cstdint>
-#include <vector>
+#include <utility>
 #include <array>
 
 class BoardManager final
 {
+ public:
+
+    /**
+     * Number of symmetries of the board (4 rotations and 4 reflections).
+     */
+    static constexpr uint8_t SYMMETRIES = 8;
+
  private:
 
+    using cell_map = std::array<std::array<uint8_t, BitBoard::CELLS>, SYMMETRIES>;
+    using mask_map = std::array<std::array<BitBoard::mask, BitBoard::FULL_MASK + 1>, SYMMETRIES>;
+
     static BoardManager * instance;
 
+    /**
+     * Computes where every cell is moved by each symmetry.
+     *
+     * @return The cell mappings
+     */
+    static constexpr auto Make_Cell_Maps() noexcept -> cell_map;
+
+    /**
+     * Computes where every occupancy mask is moved by each symmetry.
+     *
+     * @return The mask mappings
+     */
+    static constexpr auto Make_Mask_Maps() noexcept -> mask_map;
+
+    /**
+     * Computes the symmetry that undoes each symmetry.
+     *
+     * @return The inverse symmetries
+     */
+    static constexpr auto Make_Inverses() noexcept -> std::array<uint8_t, SYMMETRIES>;
+
+    static const cell_map CELL_MAPS;
+    static const mask_map MASK_MAPS;
+    static const std::array<uint8_t, SYMMETRIES> INVERSES;
+
     BoardManager() noexcept;
 
     Utility::Board game_board {};
@@ -92,9 +130,9 @@ class BoardManager final
      * Computes the available moves, i.e. the empty places on the board.
      *
      * @param current_board The board to be analysed
-     * @return A vector of available moves
+     * @return A list of available moves, in row-major order
      */
-    auto GetActions(Utility::Board const & current_board) noexcept -> std::vector<Move>;
+    [[gnu::pure]] auto GetActions(Utility::Board const & current_board) noexcept -> MoveList;
 
     /**
      * Get the winner of the current board configuration.
@@ -143,5 +181,221 @@ class BoardManager final
      * Resets the board to its initial state of emptiness.
      */
     void ResetBoard() noexcept;
+
+    /**
+     * Moves a cell according to a symmetry of the board.
+     *
+     * @param cell The cell index
+     * @param symmetry The symmetry
+     * @return The transformed cell index
+     */
+    [[nodiscard]] static constexpr auto TransformCell(uint8_t cell, uint8_t symmetry) noexcept -> uint8_t;
+
+    /**
+     * Moves all the cells of a mask according to a symmetry of the board.
+     *
+     * @param cells The cells mask
+     * @param symmetry The symmetry
+     * @return The transformed mask
+     */
+    [[nodiscard]] static constexpr auto TransformMask(BitBoard::mask cells, uint8_t symmetry) noexcept
+    -> BitBoard::mask;
+
+    /**
+     * Rotates or reflects the board according to a symmetry.
+     *
+     * @param current_board The board to be transformed
+     * @param symmetry The symmetry
+     * @return The transformed board
+     */
+    [[nodiscard]] static constexpr auto TransformBoard(BitBoard const & current_board, uint8_t symmetry) noexcept
+    -> BitBoard;
+
+    /**
+     * Gets the symmetry that undoes another one, used to map the moves found on
+     * a canonical board back to the original board.
+     *
+     * @param symmetry The symmetry
+     * @return The inverse symmetry
+     */
+    [[nodiscard]] static constexpr auto GetInverseSymmetry(uint8_t symmetry) noexcept -> uint8_t;
+
+    /**
+     * Computes the canonical representative of the board, i.e. the one with
+     * the lowest key among all its rotations and reflections.
+     *
+     * @param current_board The board to be analysed
+     * @return The canonical board and the symmetry that transforms the board
+     *         into it
+     */
+    [[nodiscard]] static constexpr auto Canonicalise(BitBoard const & current_board) noexcept
+    -> std::pair<BitBoard, uint8_t>;
+
+    /**
+     * Computes the symmetries that leave the board unchanged.
+     *
+     * @param current_board The board to be analysed
+     * @return A mask with one bit set for every such symmetry
+     */
+    [[nodiscard]] static constexpr auto GetSymmetries(BitBoard const & current_board) noexcept -> uint8_t;
+
+    /**
+     * Finds the lowest cell that a cell can be moved to by a set of
+     * symmetries. When the symmetries leave the board unchanged, the moves on
+     * the two cells lead to equivalent boards.
+     *
+     * @param cell The cell index
+     * @param symmetries A mask with one bit set for every symmetry
+     * @return The representative cell index
+     */
+    [[nodiscard]] static constexpr auto GetRepresentativeCell(uint8_t cell, uint8_t symmetries) noexcept -> uint8_t;
 };
 
+constexpr auto BoardManager::Make_Cell_Maps() noexcept -> cell_map
+{
+    cell_map maps {};
+
+    for (int row = 0; row < Utility::BOARD_SIZE; ++row)
+    {
+        for (int column = 0; column < Utility::BOARD_SIZE; ++column)
+        {
+            int const MIRRORED_ROW = Utility::BOARD_SIZE - 1 - row;
+            int const MIRRORED_COLUMN = Utility::BOARD_SIZE - 1 - column;
+
+            std::array<std::pair<int, int>, SYMMETRIES> const DESTINATIONS
+                    {{{row, column},                    /* Identity */
+                      {column, MIRRORED_ROW},           /* Rotation by 90° */
+                      {MIRRORED_ROW, MIRRORED_COLUMN},  /* Rotation by 180° */
+                      {MIRRORED_COLUMN, row},           /* Rotation by 270° */
+                      {row, MIRRORED_COLUMN},           /* Horizontal reflection */
+                      {MIRRORED_ROW, column},           /* Vertical reflection */
+                      {column, row},                    /* Main diagonal reflection */
+                      {MIRRORED_COLUMN, MIRRORED_ROW}   /* Anti-diagonal reflection */}};
+
+            for (uint8_t symmetry = 0; symmetry < SYMMETRIES; ++symmetry)
+            {
+                auto const &[NEW_ROW, NEW_COLUMN] = DESTINATIONS[symmetry];
+                maps[symmetry][row * Utility::BOARD_SIZE + column] =
+                        static_cast<uint8_t>(NEW_ROW * Utility::BOARD_SIZE + NEW_COLUMN);
+            }
+        }
+    }
+    return maps;
+}
+
+inline constexpr BoardManager::cell_map BoardManager::CELL_MAPS = Make_Cell_Maps();
+
+constexpr auto BoardManager::Make_Mask_Maps() noexcept -> mask_map
+{
+    mask_map maps {};
+
+    for (uint8_t symmetry = 0; symmetry < SYMMETRIES; ++symmetry)
+    {
+        for (uint16_t cells = 0; cells <= BitBoard::FULL_MASK; ++cells)
+        {
+            for (uint8_t cell = 0; cell < BitBoard::CELLS; ++cell)
+            {
+                if ((cells >> cell) & 1U)
+                {
+                    maps[symmetry][cells] |= static_cast<BitBoard::mask>(1U << CELL_MAPS[symmetry][cell]);
+                }
+            }
+        }
+    }
+    return maps;
+}
+
+inline constexpr BoardManager::mask_map BoardManager::MASK_MAPS = Make_Mask_Maps();
+
+constexpr auto BoardManager::Make_Inverses() noexcept -> std::array<uint8_t, SYMMETRIES>
+{
+    std::array<uint8_t, SYMMETRIES> inverses {};
+
+    for (uint8_t symmetry = 0; symmetry < SYMMETRIES; ++symmetry)
+    {
+        for (uint8_t inverse = 0; inverse < SYMMETRIES; ++inverse)
+        {
+            bool is_inverse = true;
+            for (uint8_t cell = 0; cell < BitBoard::CELLS; ++cell)
+            {
+                is_inverse = is_inverse && CELL_MAPS[inverse][CELL_MAPS[symmetry][cell]] == cell;
+            }
+            if (is_inverse)
+            {
+                inverses[symmetry] = inverse;
+            }
+        }
+    }
+    return inverses;
+}
+
+inline constexpr std::array<uint8_t, BoardManager::SYMMETRIES> BoardManager::INVERSES = Make_Inverses();
+
+constexpr auto BoardManager::TransformCell(uint8_t cell, uint8_t symmetry) noexcept -> uint8_t
+{
+    return CELL_MAPS[symmetry][cell];
+}
+
+constexpr auto BoardManager::TransformMask(BitBoard::mask cells, uint8_t symmetry) noexcept -> BitBoard::mask
+{
+    return MASK_MAPS[symmetry][cells];
+}
+
+constexpr auto BoardManager::TransformBoard(BitBoard const & current_board, uint8_t symmetry) noexcept -> BitBoard
+{
+    return {TransformMask(current_board.GetMask(Utility::PlayerSymbol::X), symmetry),
+            TransformMask(current_board.GetMask(Utility::PlayerSymbol::O), symmetry)};
+}
+
+constexpr auto BoardManager::GetInverseSymmetry(uint8_t symmetry) noexcept -> uint8_t
+{
+    return INVERSES[symmetry];
+}
+
+constexpr auto BoardManager::Canonicalise(BitBoard const & current_board) noexcept -> std::pair<BitBoard, uint8_t>
+{
+    BitBoard canonical_board = current_board;
+    uint8_t canonical_symmetry = 0;
+
+    #pragma GCC unroll 7
+    for (uint8_t symmetry = 1; symmetry < SYMMETRIES; ++symmetry)
+    {
+        auto const TRANSFORMED = TransformBoard(current_board, symmetry);
+        if (TRANSFORMED.GetKey() < canonical_board.GetKey())
+        {
+            canonical_board = TRANSFORMED;
+            canonical_symmetry = symmetry;
+        }
+    }
+    return {canonical_board, canonical_symmetry};
+}
+
+constexpr auto BoardManager::GetSymmetries(BitBoard const & current_board) noexcept -> uint8_t
+{
+    uint8_t symmetries = 0;
+
+    #pragma GCC unroll 8
+    for (uint8_t symmetry = 0; symmetry < SYMMETRIES; ++symmetry)
+    {
+        if (TransformBoard(current_board, symmetry) == current_board)
+        {
+            symmetries |= static_cast<uint8_t>(1U << symmetry);
+        }
+    }
+    return symmetries;
+}
+
+constexpr auto BoardManager::GetRepresentativeCell(uint8_t cell, uint8_t symmetries) noexcept -> uint8_t
+{
+    uint8_t representative = cell;
+
+    #pragma GCC unroll 8
+    for (uint8_t symmetry = 0; symmetry < SYMMETRIES; ++symmetry)
+    {
+        if ((symmetries >> symmetry) & 1U)
+        {
+            representative = std::min(representative, TransformCell(cell, symmetry));
+        }
+    }
+    return representative;
+}
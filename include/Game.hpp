@@ -9,22 +9,22 @@
 
 #pragma once
 
-#include <hardware/regs/rosc.h>
-#include <pico/multicore.h>
+#include <hardware/sync.h>
 
 #include "IPlayerStrategy.hpp"
+#include "SearchWorker.hpp"
+#include "Profiler.hpp"
 #include "LCD_I2C.hpp"
 #include "TM1637.hpp"
 #include "Keypad.hpp"
 #include "Player.hpp"
 #include "Move.hpp"
 
-#include <unordered_map>
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <random>
-#include <vector>
 #include <array>
 
 class Game final
@@ -42,6 +42,17 @@ class Game final
 
     static constexpr byte TEXT_START_COLUMN = 8;
 
+    static constexpr byte DOTS_START_COLUMN = 16;
+    static constexpr byte DOTS_COUNT = 3;
+
+    static constexpr Key BACKLIGHT_KEY = Key::KEY13;
+    static constexpr Key BRIGHTNESS_KEY = Key::KEY14;
+
+    /**
+     * Key that makes the computer play the best move found so far.
+     */
+    static constexpr Key MOVE_NOW_KEY = Key::KEY16;
+
     std::unique_ptr<Player> first_player {std::make_unique<Player>(Utility::PlayerSymbol::UNK, new HumanStrategy)};
     std::unique_ptr<Player> second_player;
 
@@ -51,10 +62,28 @@ class Game final
     std::unique_ptr<TM1637> led_segments;
     std::unique_ptr<Keypad> keypad;
 
+    bool light_on {false};
+    byte brightness {0};
+
+    /**
+     * The game whose peripherals are used by the key handler, which the
+     * keypad calls without a context.
+     */
+    static inline Game * key_handler_game {nullptr};
+
+    /**
+     * Starts the search worker on the second core and takes over the keys
+     * that work at any time.
+     */
+    void Init_Second_Core() noexcept;
+
     /**
-     * Starts the key poller on the second core.
+     * Handles the backlight and brightness keys whenever they are read.
+     *
+     * @param key The key
+     * @return True if the key was handled
      */
-    void Init_Second_Core() const noexcept;
+    static auto Handle_Control_Key(Key key) noexcept -> bool;
 
     /**
      * Converts the board piece to a LCD screen custom character memory
@@ -94,6 +123,16 @@ class Game final
      */
     inline void Print_Second_Player_Info() const noexcept;
 
+    /**
+     * Gets the move of the computer from the second core. Meanwhile, the dots
+     * after "thinking" follow the progress of the search, the control keys
+     * keep working and the move now key cancels the search. The other keys
+     * are ignored.
+     *
+     * @return The move
+     */
+    [[nodiscard]] auto Get_Computer_Move() noexcept -> Move;
+
     /**
      * Main game logic
      */
@@ -139,11 +178,6 @@ class Game final
      */
     [[nodiscard]] inline auto Get_User() const noexcept -> Utility::PlayerSymbol;
 
-    /**
-     * Key poller that runs on the second core.
-     */
-    [[noreturn]] static void Key_Poller_Runner() noexcept;
-
     /**
      * Prompts the user to select between a Human or AI opponent.
      */
@@ -0,0 +1,540 @@
+/*******************************************************************************
+ * @file GridBoard.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the GridBoard class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "Utility.hpp"
+
+#include <cstdint>
+#include <algorithm>
+#include <cstddef>
+#include <array>
+#include <bit>
+
+/**
+ * Board of any size where a player wins by placing K pieces in a row, column
+ * or diagonal (e.g. 3x3 tic-tac-toe, 4x4 four-in-a-row or 15x15 gomoku). The
+ * pieces of each player are kept as a bit set, one bit per cell in row-major
+ * order. Wins are only looked for around the last move, so checking a move
+ * costs O(K) instead of scanning the whole board. Boards are limited to 15x15
+ * so that the plies of a whole game fit the 8-bit search counters.
+ *
+ * @tparam N The number of rows and columns
+ * @tparam K The number of pieces in a row needed to win
+ */
+template <uint8_t N, uint8_t K>
+class GridBoard final
+{
+    static_assert(N >= 1 && N <= 15, "The board must have between 1 and 15 rows");
+    static_assert(K >= 1 && K <= N, "The winning row must fit on the board");
+
+ public:
+
+    using cell = uint16_t;
+
+    static constexpr uint8_t SIZE = N;
+    static constexpr uint8_t IN_A_ROW = K;
+    static constexpr cell CELLS = N * N;
+
+    /**
+     * Row and column steps of the four line directions: horizontal, vertical,
+     * main diagonal and anti-diagonal.
+     */
+    static constexpr std::array<std::array<int8_t, 2>, 4> DIRECTIONS {{{0, 1}, {1, 0}, {1, 1}, {1, -1}}};
+
+    /**
+     * Fixed-capacity list of cells, so generating moves never allocates.
+     */
+    class CellList final
+    {
+     private:
+
+        std::array<cell, CELLS> cells {};
+        cell size {0};
+
+     public:
+
+        /**
+         * Appends a cell to the list.
+         *
+         * @param new_cell The cell
+         */
+        constexpr void Add(cell new_cell) noexcept;
+
+        /**
+         * Gets the number of cells in the list.
+         *
+         * @return The size
+         */
+        [[nodiscard]] constexpr auto GetSize() const noexcept -> cell;
+
+        /**
+         * [Subscript operator] Gets a cell by its position.
+         *
+         * @param index The position in the list
+         * @return The cell
+         */
+        [[nodiscard]] constexpr auto operator[](cell index) noexcept -> cell &;
+
+        /**
+         * [Subscript operator] Gets a cell by its position.
+         *
+         * @param index The position in the list
+         * @return The cell
+         */
+        [[nodiscard]] constexpr auto operator[](cell index) const noexcept -> cell;
+
+        [[nodiscard]] constexpr auto begin() noexcept -> cell *;
+
+        [[nodiscard]] constexpr auto end() noexcept -> cell *;
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> cell const *;
+
+        [[nodiscard]] constexpr auto end() const noexcept -> cell const *;
+    };
+
+ private:
+
+    static constexpr size_t WORD_SIZE = 64;
+    static constexpr size_t WORDS = (CELLS + WORD_SIZE - 1) / WORD_SIZE;
+
+    using bits = std::array<uint64_t, WORDS>;
+
+    /**
+     * Random number of every piece on every cell, XOR-ed together into the
+     * key of a position (Zobrist hashing), so a move updates the key with a
+     * single XOR. The numbers come from a fixed SplitMix64 sequence.
+     */
+    static constexpr auto PIECE_KEYS = []
+    {
+        std::array<std::array<uint64_t, CELLS>, 2> keys {};
+        uint64_t state = 0;
+        for (auto & player_keys: keys)
+        {
+            for (auto & key: player_keys)
+            {
+                state += 0x9E37'79B9'7F4A'7C15;
+                auto mixed = state;
+                mixed = (mixed ^ (mixed >> 30)) * 0xBF58'476D'1CE4'E5B9;
+                mixed = (mixed ^ (mixed >> 27)) * 0x94D0'49BB'1331'11EB;
+                key = mixed ^ (mixed >> 31);
+            }
+        }
+        return keys;
+    }();
+
+    std::array<bits, 2> pieces {};
+    cell move_count {0};
+    uint64_t hash {0};
+
+    /**
+     * Gets the index of the bit set of a player.
+     *
+     * @param player The player
+     * @return The index
+     */
+    [[nodiscard]] static constexpr auto Get_Player_Index(Utility::PlayerSymbol player) noexcept -> size_t;
+
+    /**
+     * Counts the pieces of a player found next to a cell in one direction,
+     * stopping after K - 1 pieces.
+     *
+     * @param row The row of the cell
+     * @param column The column of the cell
+     * @param row_step The row step of the direction
+     * @param column_step The column step of the direction
+     * @param player The player
+     * @return The number of pieces
+     */
+    [[nodiscard]] constexpr auto Count_Run(int row, int column, int row_step, int column_step,
+                                           Utility::PlayerSymbol player) const noexcept -> uint8_t;
+
+ public:
+
+    /**
+     * [Constructor] Creates an empty board.
+     */
+    constexpr GridBoard() noexcept = default;
+
+    /**
+     * Computes the index of a cell.
+     *
+     * @param row The row
+     * @param column The column
+     * @return The cell index
+     */
+    [[nodiscard]] static constexpr auto GetCell(uint8_t row, uint8_t column) noexcept -> cell;
+
+    /**
+     * Counts the lines of K cells that go through a cell, i.e. how many ways
+     * a piece placed there can be part of a win. It is highest in the centre.
+     *
+     * @param target The cell index
+     * @return The number of lines
+     */
+    [[nodiscard]] static constexpr auto GetLineCount(cell target) noexcept -> uint8_t;
+
+    /**
+     * Checks if a player has a piece on a cell.
+     *
+     * @param target The cell index
+     * @param player The player
+     * @return True or False
+     */
+    [[nodiscard]] constexpr auto HasPiece(cell target, Utility::PlayerSymbol player) const noexcept -> bool;
+
+    /**
+     * Gets the piece found on a cell.
+     *
+     * @param target The cell index
+     * @return The piece
+     */
+    [[nodiscard]] constexpr auto GetPiece(cell target) const noexcept -> Utility::PlayerSymbol;
+
+    /**
+     * Gets the number of pieces of a player.
+     *
+     * @param player The player
+     * @return The number of pieces
+     */
+    [[nodiscard]] constexpr auto GetPieceCount(Utility::PlayerSymbol player) const noexcept -> cell;
+
+    /**
+     * Gets the number of pieces on the board.
+     *
+     * @return The number of pieces
+     */
+    [[nodiscard]] constexpr auto GetMoveCount() const noexcept -> cell;
+
+    /**
+     * Computes the current player based on the number of pieces on the board.
+     *
+     * @return The current player
+     */
+    [[nodiscard]] constexpr auto GetCurrentPlayer() const noexcept -> Utility::PlayerSymbol;
+
+    /**
+     * Gets the Zobrist key of the position. Different positions can share a
+     * key, although it is very unlikely.
+     *
+     * @return The key
+     */
+    [[nodiscard]] constexpr auto GetHash() const noexcept -> uint64_t;
+
+    /**
+     * Checks if the board is full with pieces.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] constexpr auto IsFull() const noexcept -> bool;
+
+    /**
+     * Gets the empty cells, i.e. the available moves, in increasing order.
+     *
+     * @return The empty cells
+     */
+    [[nodiscard]] constexpr auto GetMoves() const noexcept -> CellList;
+
+    /**
+     * Checks if the piece on a cell completes K in a row. Only the lines
+     * through the cell are checked, so it costs O(K).
+     *
+     * @param target The cell of the last move
+     * @param player The player who made the move
+     * @return True or False
+     */
+    [[nodiscard]] constexpr auto IsWinningMove(cell target, Utility::PlayerSymbol player) const noexcept -> bool;
+
+    /**
+     * Checks if the player has K in a row anywhere on the board. It scans
+     * every cell, so it should only be used on positions that were not built
+     * move by move.
+     *
+     * @param player The player
+     * @return True or False
+     */
+    [[nodiscard]] constexpr auto IsWinner(Utility::PlayerSymbol player) const noexcept -> bool;
+
+    /**
+     * Places a piece on an empty cell.
+     *
+     * @param target The cell index
+     * @param player The player making the move
+     */
+    constexpr void MakeMove(cell target, Utility::PlayerSymbol player) noexcept;
+
+    /**
+     * Removes the piece from a cell.
+     *
+     * @param target The cell index
+     */
+    constexpr void UnmakeMove(cell target) noexcept;
+
+    /**
+     * [Equality operator] Checks if the boards are the same.
+     */
+    friend constexpr auto operator==(GridBoard const & lhs, GridBoard const & rhs) noexcept -> bool = default;
+};
+
+template <uint8_t N, uint8_t K>
+constexpr void GridBoard<N, K>::CellList::Add(cell new_cell) noexcept
+{
+    cells[size++] = new_cell;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::CellList::GetSize() const noexcept -> cell
+{
+    return size;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::CellList::operator[](cell index) noexcept -> cell &
+{
+    return cells[index];
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::CellList::operator[](cell index) const noexcept -> cell
+{
+    return cells[index];
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::CellList::begin() noexcept -> cell *
+{
+    return cells.data();
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::CellList::end() noexcept -> cell *
+{
+    return cells.data() + size;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::CellList::begin() const noexcept -> cell const *
+{
+    return cells.data();
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::CellList::end() const noexcept -> cell const *
+{
+    return cells.data() + size;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::Get_Player_Index(Utility::PlayerSymbol player) noexcept -> size_t
+{
+    return (player == Utility::PlayerSymbol::X) ? 0 : 1;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::Count_Run(int row, int column, int row_step, int column_step,
+                                          Utility::PlayerSymbol player) const noexcept -> uint8_t
+{
+    uint8_t count = 0;
+
+    for (row += row_step, column += column_step; count < K - 1; row += row_step, column += column_step)
+    {
+        if (row < 0 || row >= N || column < 0 || column >= N ||
+                !HasPiece(GetCell(static_cast<uint8_t>(row), static_cast<uint8_t>(column)), player))
+        {
+            break;
+        }
+        ++count;
+    }
+    return count;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetCell(uint8_t row, uint8_t column) noexcept -> cell
+{
+    return static_cast<cell>(row * N + column);
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetLineCount(cell target) noexcept -> uint8_t
+{
+    auto const ROW = target / N;
+    auto const COLUMN = target % N;
+    uint8_t count = 0;
+
+    for (auto const & [ROW_STEP, COLUMN_STEP]: DIRECTIONS)
+    {
+        for (int offset = 0; offset < K; ++offset)
+        {
+            auto const FIRST_ROW = ROW - offset * ROW_STEP;
+            auto const FIRST_COLUMN = COLUMN - offset * COLUMN_STEP;
+            auto const LAST_ROW = FIRST_ROW + (K - 1) * ROW_STEP;
+            auto const LAST_COLUMN = FIRST_COLUMN + (K - 1) * COLUMN_STEP;
+
+            if (std::min(FIRST_ROW, LAST_ROW) >= 0 && std::max(FIRST_ROW, LAST_ROW) < N &&
+                    std::min(FIRST_COLUMN, LAST_COLUMN) >= 0 && std::max(FIRST_COLUMN, LAST_COLUMN) < N)
+            {
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::HasPiece(cell target, Utility::PlayerSymbol player) const noexcept -> bool
+{
+    return (pieces[Get_Player_Index(player)][target / WORD_SIZE] >> (target % WORD_SIZE)) & 1U;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetPiece(cell target) const noexcept -> Utility::PlayerSymbol
+{
+    if (HasPiece(target, Utility::PlayerSymbol::X))
+    {
+        return Utility::PlayerSymbol::X;
+    }
+    if (HasPiece(target, Utility::PlayerSymbol::O))
+    {
+        return Utility::PlayerSymbol::O;
+    }
+    return Utility::PlayerSymbol::UNK;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetPieceCount(Utility::PlayerSymbol player) const noexcept -> cell
+{
+    cell count = 0;
+    for (auto const WORD: pieces[Get_Player_Index(player)])
+    {
+        count = static_cast<cell>(count + std::popcount(WORD));
+    }
+    return count;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetMoveCount() const noexcept -> cell
+{
+    return move_count;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetCurrentPlayer() const noexcept -> Utility::PlayerSymbol
+{
+    return (move_count % 2 == 0) ? Utility::PlayerSymbol::X : Utility::PlayerSymbol::O;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetHash() const noexcept -> uint64_t
+{
+    return hash;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::IsFull() const noexcept -> bool
+{
+    return move_count == CELLS;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::GetMoves() const noexcept -> CellList
+{
+    CellList moves {};
+
+    for (size_t word = 0; word < WORDS; ++word)
+    {
+        auto empty = ~(pieces[0][word] | pieces[1][word]);
+        if (word == WORDS - 1 && CELLS % WORD_SIZE != 0)
+        {
+            empty &= (uint64_t {1} << (CELLS % WORD_SIZE)) - 1;
+        }
+        for (; empty != 0; empty &= empty - 1)
+        {
+            moves.Add(static_cast<cell>(word * WORD_SIZE + static_cast<size_t>(std::countr_zero(empty))));
+        }
+    }
+    return moves;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::IsWinningMove(cell target, Utility::PlayerSymbol player) const noexcept -> bool
+{
+    auto const ROW = target / N;
+    auto const COLUMN = target % N;
+
+    #pragma GCC unroll 4
+    for (auto const & [ROW_STEP, COLUMN_STEP]: DIRECTIONS)
+    {
+        if (1 + Count_Run(ROW, COLUMN, ROW_STEP, COLUMN_STEP, player) +
+                Count_Run(ROW, COLUMN, -ROW_STEP, -COLUMN_STEP, player) >= K)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr auto GridBoard<N, K>::IsWinner(Utility::PlayerSymbol player) const noexcept -> bool
+{
+    for (cell target = 0; target < CELLS; ++target)
+    {
+        if (HasPiece(target, player) && IsWinningMove(target, player))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr void GridBoard<N, K>::MakeMove(cell target, Utility::PlayerSymbol player) noexcept
+{
+    pieces[Get_Player_Index(player)][target / WORD_SIZE] |= uint64_t {1} << (target % WORD_SIZE);
+    hash ^= PIECE_KEYS[Get_Player_Index(player)][target];
+    ++move_count;
+}
+
+template <uint8_t N, uint8_t K>
+constexpr void GridBoard<N, K>::UnmakeMove(cell target) noexcept
+{
+    auto const BIT = ~(uint64_t {1} << (target % WORD_SIZE));
+
+    hash ^= PIECE_KEYS[Get_Player_Index(GetPiece(target))][target];
+    pieces[0][target / WORD_SIZE] &= BIT;
+    pieces[1][target / WORD_SIZE] &= BIT;
+    --move_count;
+}
+
+// The incremental check must agree with the well known 3x3 results
+static_assert([]
+{
+    GridBoard<3, 3> board {};
+    board.MakeMove(GridBoard<3, 3>::GetCell(0, 2), Utility::PlayerSymbol::X);
+    board.MakeMove(GridBoard<3, 3>::GetCell(1, 1), Utility::PlayerSymbol::X);
+    board.MakeMove(GridBoard<3, 3>::GetCell(2, 0), Utility::PlayerSymbol::X);
+    return board.IsWinningMove(GridBoard<3, 3>::GetCell(1, 1), Utility::PlayerSymbol::X) &&
+           !board.IsWinningMove(GridBoard<3, 3>::GetCell(1, 1), Utility::PlayerSymbol::O);
+}(), "The anti-diagonal must be a winning line");
+static_assert([]
+{
+    GridBoard<3, 3> first {};
+    first.MakeMove(0, Utility::PlayerSymbol::X);
+    first.MakeMove(4, Utility::PlayerSymbol::O);
+    first.MakeMove(8, Utility::PlayerSymbol::X);
+    GridBoard<3, 3> second {};
+    second.MakeMove(8, Utility::PlayerSymbol::X);
+    second.MakeMove(4, Utility::PlayerSymbol::O);
+    second.MakeMove(0, Utility::PlayerSymbol::X);
+    second.MakeMove(1, Utility::PlayerSymbol::O);
+    second.UnmakeMove(1);
+    return first.GetHash() == second.GetHash() && first.GetHash() != GridBoard<3, 3> {}.GetHash();
+}(), "The key must only depend on the position");
+static_assert(GridBoard<15, 5>::GetCell(14, 14) == 224, "Cells are numbered in row-major order");
+static_assert(GridBoard<3, 3>::GetLineCount(4) == 4 && GridBoard<3, 3>::GetLineCount(0) == 3 &&
+              GridBoard<3, 3>::GetLineCount(1) == 2, "The centre must be on the most lines");
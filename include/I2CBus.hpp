@@ -0,0 +1,305 @@
+/*******************************************************************************
+ * @file I2CBus.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the I2CBus class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <hardware/i2c.h>
+#include <pico/sync.h>
+
+#include <cstdint>
+#include <atomic>
+#include <array>
+
+/**
+ * Manager of an I2C bus shared by several devices. It finds the fastest
+ * standard speed that every device acknowledges reliably, and it owns the
+ * controller: each device can queue one transfer of DATA_CMD words that a
+ * DMA channel feeds to the controller in the background, the devices with a
+ * queued transfer are served in turn, and blocking transfers wait until the
+ * bus is free. A queued transfer ends in the interrupt of the controller,
+ * once its STOP is on the bus, so the bytes, the bus time and the NAKs
+ * counted for every device are those of the bus and not of the DMA channel.
+ * There can be one bus per I2C controller.
+ */
+class I2CBus final
+{
+ public:
+
+    using device = uint8_t;
+
+    /**
+     * Word written by the DMA channel to the DATA_CMD register of the I2C
+     * controller: a byte and the STOP bit that ends the transfer.
+     */
+    using entry = uint16_t;
+
+    /**
+     * Function called from the I2C interrupt when a queued transfer is sent.
+     */
+    using callback = void (*)(void * context) noexcept;
+
+    static constexpr device MAX_DEVICES = 4;
+
+    /**
+     * Returned by AddDevice() when the bus is full.
+     */
+    static constexpr device NO_DEVICE = 0xFF;
+
+    /**
+     * Traffic of a device since the bus was created.
+     */
+    struct Statistics
+    {
+        uint64_t bytes {0};     /* Bytes sent or received */
+        uint64_t bus_time {0};  /* Time its transfers held the bus in microseconds */
+        uint32_t transfers {0};
+        uint32_t naks {0};      /* Transfers not acknowledged */
+
+        /**
+         * Computes the throughput of the device while it holds the bus.
+         *
+         * @return The bytes per second, or 0 if there was no transfer
+         */
+        [[nodiscard]] constexpr auto GetBytesPerSecond() const noexcept -> uint32_t;
+    };
+
+ private:
+
+    /**
+     * Standard speeds tried by Probe(), from the fastest.
+     */
+    static constexpr std::array<uint, 3> SPEEDS {1'000'000, 400'000, 100'000};
+
+    /**
+     * Reads each device must acknowledge for a speed to be kept.
+     */
+    static constexpr uint8_t PROBE_ROUNDS = 8;
+
+    static constexpr uint64_t BYTE_BITS_NANOSECONDS = 9 * 1'000'000'000ULL; /* 8 data bits and the acknowledge */
+
+    struct Transfer
+    {
+        entry const * words {nullptr};
+        size_t length {0};
+        callback done {nullptr};
+        void * context {nullptr};
+    };
+
+    struct Device
+    {
+        uint8_t address {0};
+        uint max_speed {SPEEDS.front()};    /* Fastest speed the device is rated for */
+        Transfer transfer {};
+        std::atomic<bool> pending {false};  /* The transfer is waiting for the bus */
+        Statistics statistics {};
+    };
+
+    /**
+     * Bus of each I2C controller, used by its interrupt handler.
+     */
+    static std::array<I2CBus *, NUM_I2CS> owners;
+
+    i2c_inst * I2C_instance {nullptr};
+    uint baud_rate {0};
+    uint32_t byte_time {0};               /* Nanoseconds the bus takes to send a byte */
+    uint dma_channel {0};
+
+    std::array<Device, MAX_DEVICES> devices {};
+    device device_count {0};
+
+    std::atomic<bool> busy {false};       /* The controller is owned by a transfer */
+    device current {NO_DEVICE};           /* Device of the DMA transfer */
+    device next {0};                      /* First device to look at for the next transfer */
+    uint64_t transfer_start {0};
+    bool aborted {false};                 /* The controller aborted the transfer */
+
+    critical_section_t lock {};           /* Guards the statistics and the taking of the bus */
+
+    /**
+     * Handles the interrupt of the first I2C controller.
+     */
+    static void Handle_I2C0_Interrupt() noexcept;
+
+    /**
+     * Handles the interrupt of the second I2C controller.
+     */
+    static void Handle_I2C1_Interrupt() noexcept;
+
+    /**
+     * Handles the interrupt of the controller: notes an abort, and once the
+     * STOP of the transfer is on the bus and the FIFO is empty, counts the
+     * transfer, gives the entries back to the device and starts the next
+     * queued transfer.
+     */
+    void Handle_Interrupt() noexcept;
+
+    /**
+     * Sets the speed of the bus.
+     *
+     * @param speed The speed in bits per second
+     */
+    void Set_Speed(uint speed) noexcept;
+
+    /**
+     * Starts the next queued transfer if the bus is free. The devices are
+     * served in turn, so a device queueing transfers back to back cannot hold
+     * the bus.
+     */
+    void Start_Next() noexcept;
+
+    /**
+     * Takes the bus if it is free. The flag is tested and set under the lock,
+     * since the Cortex-M0+ has no atomic exchange.
+     *
+     * @return True if the bus was taken
+     */
+    [[nodiscard]] auto Try_Acquire() noexcept -> bool;
+
+    /**
+     * Waits until the bus is free and takes it for a blocking transfer.
+     */
+    void Acquire() noexcept;
+
+    /**
+     * Frees the bus taken by Acquire() and starts the next queued transfer.
+     */
+    void Release() noexcept;
+
+    /**
+     * Counts a transfer of a device.
+     *
+     * @param handle The device
+     * @param length The number of bytes
+     * @param start The start of the transfer in microseconds
+     * @param acknowledged True if the device acknowledged it
+     */
+    void Record(device handle, size_t length, uint64_t start, bool acknowledged) noexcept;
+
+ public:
+
+    /**
+     * [Constructor] Initialises the I2C controller on the provided pins at
+     * the standard speed, claims the DMA channel that sends the queued
+     * transfers and takes the interrupt of the controller, which must not
+     * have another bus.
+     *
+     * @param I2C The I2C instance
+     * @param SDA The serial data pin
+     * @param SCL The serial clock pin
+     */
+    I2CBus(i2c_inst * I2C = PICO_DEFAULT_I2C_INSTANCE, uint SDA = PICO_DEFAULT_I2C_SDA_PIN,
+           uint SCL = PICO_DEFAULT_I2C_SCL_PIN) noexcept;
+
+    I2CBus(I2CBus const &) = delete;
+    I2CBus(I2CBus &&) = delete;
+    auto operator=(I2CBus const &) -> I2CBus & = delete;
+    auto operator=(I2CBus &&) -> I2CBus & = delete;
+
+    /**
+     * Adds a device to the bus. Adding an address twice gives the same
+     * device, rated for the slower of the two speeds.
+     *
+     * @param address The 7-bit device address
+     * @param max_speed The fastest speed the device is rated for, in bits
+     *                  per second
+     * @return The device, used by the other functions, or NO_DEVICE if there
+     *         are already MAX_DEVICES
+     */
+    auto AddDevice(uint8_t address, uint max_speed = SPEEDS.front()) noexcept -> device;
+
+    /**
+     * Tries the standard speeds from the fastest one every device is rated
+     * for and keeps the first one at which every device acknowledges a few
+     * reads in a row, or the slowest one. It must run before the devices queue timed transfers, since their
+     * padding depends on the speed.
+     *
+     * @return The speed of the bus in bits per second
+     */
+    auto Probe() noexcept -> uint;
+
+    /**
+     * Queues a transfer of DATA_CMD words, sent in the background. The last
+     * word must have the STOP bit. A device can have one queued transfer at
+     * a time, and the words must stay untouched until the callback runs.
+     *
+     * @param handle The device
+     * @param words The words
+     * @param length The number of words
+     * @param done The function called when the transfer is sent
+     * @param context The argument of the callback
+     */
+    void Submit(device handle, entry const * words, size_t length, callback done, void * context) noexcept;
+
+    /**
+     * Writes bytes to a device, waiting for the bus to be free.
+     *
+     * @param handle The device
+     * @param data The bytes
+     * @param length The number of bytes
+     * @return True if the device acknowledged them
+     */
+    auto Write(device handle, uint8_t const * data, size_t length) noexcept -> bool;
+
+    /**
+     * Reads bytes from a device, waiting for the bus to be free.
+     *
+     * @param handle The device
+     * @param data The bytes read
+     * @param length The number of bytes
+     * @return True if the device acknowledged the read
+     */
+    auto Read(device handle, uint8_t * data, size_t length) noexcept -> bool;
+
+    /**
+     * Waits until no transfer is queued or being sent.
+     */
+    void WaitForIdle() const noexcept;
+
+    /**
+     * Gets the speed of the bus.
+     *
+     * @return The speed in bits per second
+     */
+    [[nodiscard]] auto GetBaudRate() const noexcept -> uint;
+
+    /**
+     * Gets the time the bus takes to send a byte and its acknowledge.
+     *
+     * @return The time in nanoseconds
+     */
+    [[nodiscard]] auto GetByteTime() const noexcept -> uint32_t;
+
+    /**
+     * Gets the number of devices on the bus.
+     *
+     * @return The number of devices
+     */
+    [[nodiscard]] auto GetDeviceCount() const noexcept -> device;
+
+    /**
+     * Gets the address of a device.
+     *
+     * @param handle The device
+     * @return The 7-bit address
+     */
+    [[nodiscard]] auto GetAddress(device handle) const noexcept -> uint8_t;
+
+    /**
+     * Gets the traffic of a device.
+     *
+     * @param handle The device
+     * @return A copy of its statistics
+     */
+    [[nodiscard]] auto GetStatistics(device handle) noexcept -> Statistics;
+};
+
+constexpr auto I2CBus::Statistics::GetBytesPerSecond() const noexcept -> uint32_t
+{
+    return (bus_time == 0) ? 0 : static_cast<uint32_t>(bytes * 1'000'000 / bus_time);
+}
@@ -9,21 +9,64 @@
 
 #pragma once
 
-#include <hardware/regs/addressmap.h>
-#include <hardware/regs/rosc.h>
-
+#include <hardware/structs/rosc.h>
+#include <pico/time.h>
+
+#include "TranspositionTable.hpp"
+#include "PrincipalVariation.hpp"
+#include "SearchStatistics.hpp"
+#include "MonteCarloSearch.hpp"
+#include "MoveOrdering.hpp"
 #include "BoardManager.hpp"
+#include "MoveList.hpp"
+#include "BitBoard.hpp"
 #include "Utility.hpp"
 
-#include <unordered_map>
+#include <algorithm>
 #include <random>
 
+#ifndef TIC_TAC_TOE_MCTS_NODES
+#define TIC_TAC_TOE_MCTS_NODES 4096
+#endif
+
+/**
+ * Follows a search while it runs, possibly on the other core: the search
+ * reports how far it got and asks whether it should stop early.
+ */
+class ISearchMonitor
+{
+ public:
+
+    /**
+     * Receives the progress of the search.
+     *
+     * @param done The number of root moves searched
+     * @param total The number of root moves
+     */
+    virtual void ReportProgress(uint8_t done, uint8_t total) noexcept = 0;
+
+    /**
+     * Checks if the search was asked to stop and play the best move found so
+     * far.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] virtual auto IsCancelled() noexcept -> bool = 0;
+
+    /**
+     * [Destructor]
+     */
+    virtual ~ISearchMonitor() noexcept = default;
+};
+
 class IPlayerStrategy
 {
  private:
 
     std::mt19937 random_number_generator;
 
+    ISearchMonitor * search_monitor {nullptr};
+
     /**
      * Random function found on Google that does the job, using something
      * called Fowler–Noll–Vo hash function. I have no idea what it does.
@@ -40,9 +83,42 @@ class IPlayerStrategy
     static constexpr auto VALUE_MAX = std::numeric_limits<Utility::Value>::max();
 
     /**
-     * Replacement for -INFINITY
+     * Replacement for -INFINITY, kept symmetrical to VALUE_MAX so that it can
+     * be negated
+     */
+    static constexpr auto VALUE_MIN = static_cast<Utility::Value>(-VALUE_MAX);
+
+    /**
+     * Selects a move from the list uniformly at random using the RNG.
+     *
+     * @param moves The moves to choose from (must not be empty)
+     * @return A random move
      */
-    static constexpr auto VALUE_MIN = std::numeric_limits<Utility::Value>::min();
+    auto Get_Random_Move(MoveList const & moves) noexcept -> Move;
+
+    /**
+     * Selects a move from the cells of a mask uniformly at random using the
+     * RNG.
+     *
+     * @param cells The cells to choose from (must not be empty)
+     * @return A random move
+     */
+    auto Get_Random_Move(BitBoard::mask cells) noexcept -> Move;
+
+    /**
+     * Reports the progress of the search to the monitor, if there is one.
+     *
+     * @param done The number of root moves searched
+     * @param total The number of root moves
+     */
+    void Report_Progress(uint8_t done, uint8_t total) const noexcept;
+
+    /**
+     * Checks if the monitor, if there is one, asked the search to stop.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] auto Is_Cancelled() const noexcept -> bool;
 
  public:
 
@@ -58,6 +134,14 @@ class IPlayerStrategy
      */
     auto GetRNG() noexcept -> std::mt19937 &;
 
+    /**
+     * Sets the monitor that follows the next searches. The strategies that
+     * answer instantly ignore it.
+     *
+     * @param monitor The monitor, or nullptr to stop reporting
+     */
+    void SetSearchMonitor(ISearchMonitor * monitor) noexcept;
+
     /**
      * Selects a move according to the current board configuration.
      *
@@ -202,52 +286,138 @@ class MediumStrategy final : public IPlayerStrategy
 
 class HardStrategy final : public IPlayerStrategy
 {
+ public:
+
+    /**
+     * How the best moves are found.
+     */
+    enum class Mode : uint8_t
+    {
+        TABLE, /* Lookup in the precomputed perfect-play table */
+        SEARCH /* Alpha–beta search at runtime */
+    };
+
+    /**
+     * Line of best play, as cells of the board.
+     */
+    using Line = PrincipalVariation<BitBoard::CELLS>;
+
  private:
 
+    Mode mode {Mode::TABLE};
+    bool opening_book {true};
+
+    TranspositionTable transposition_table;
+
+    using Orderer = MoveOrderer<BitBoard::CELLS, SearchStatistics::MAX_PLY>;
+
+    /**
+     * On this small board the static order prunes the most; the killer moves
+     * add nothing and the history table only gets in its way.
+     */
+    Orderer orderer {MoveOrdering::STATIC};
+
+    SearchStatistics statistics;
+    uint8_t root_move_count {0};
+
+    std::array<Line, BitBoard::CELLS> root_lines {};
+    Line principal_variation {};
+
     /**
-     * Helper function to get the minimum data possible used in the function
-     * GetNextMove(Board const &).
+     * Counts a visited node and the deepest ply reached. It does nothing if
+     * the statistics are disabled.
      *
-     * @param current_board The board to be analysed
-     * @param alpha The alpha parameter
-     * @param beta The beta parameter
-     * @return The minimum data
+     * @param current_board The visited position
+     */
+    void Count_Node(BitBoard const & current_board) noexcept;
+
+    /**
+     * Computes the distance of a position from the root of the search.
+     *
+     * @param current_board The position
+     * @return The ply
+     */
+    [[nodiscard]] auto Get_Ply(BitBoard const & current_board) const noexcept -> uint8_t;
+
+    /**
+     * Orders the moves of a position, with the winning and blocking moves
+     * first if the ordering allows it.
+     *
+     * @param current_board The position, left unchanged
+     * @param player The player to move
+     * @return The moves, ready to be handed out in order
+     */
+    [[nodiscard]] auto Order_Moves(BitBoard & current_board,
+                                   Utility::PlayerSymbol player) const noexcept -> MovePicker<BitBoard::CELLS>;
+
+    /**
+     * Counts a cutoff, as an alpha cutoff if O is to move and as a beta
+     * cutoff if X is. It does nothing if the statistics are disabled.
+     *
+     * @param current_board The position where the cutoff happened
+     * @param player The player to move
      */
-    [[nodiscard]] auto Get_Min_Value(Utility::Board const & current_board,
-                                     Utility::Value alpha, Utility::Value beta) const noexcept -> Utility::Value;
+    void Count_Cutoff(BitBoard const & current_board, Utility::PlayerSymbol player) noexcept;
 
     /**
-     * Helper function to get the maximum data possible used in the function
-     * GetNextMove(Board const &).
+     * Helper function to get the value of a position for the player to move
+     * (negamax), used in the function GetNextMove(Board const &). The first
+     * move is searched with the full window and the others with a null
+     * window, which is only widened again when a move turns out better
+     * (principal variation search). The moves are made and unmade in place,
+     * so the board is left unchanged when the function returns. The result
+     * is cached in the transposition table.
      *
      * @param current_board The board to be analysed
      * @param alpha The alpha parameter
      * @param beta The beta parameter
-     * @return The maximum data
+     * @param line The best line found below the position
+     * @return The value for the player to move
+     */
+    [[nodiscard]] auto Get_Value(BitBoard & current_board, Utility::Value alpha, Utility::Value beta,
+                                 Line & line) noexcept -> Utility::Value;
+
+    /**
+     * Builds the principal variation of a move chosen at the root. The lines
+     * of the moves skipped because of a symmetry are mapped from the line of
+     * their representative.
+     *
+     * @param current_board The root position
+     * @param cell The chosen cell
+     * @param from_table Whether the move was not searched but looked up, so
+     *                   the line is followed in the perfect-play table
      */
-    [[nodiscard]] auto Get_Max_Value(Utility::Board const & current_board,
-                                     Utility::Value alpha, Utility::Value beta) const noexcept -> Utility::Value;
+    void Make_Principal_Variation(BitBoard current_board, uint8_t cell, bool from_table) noexcept;
 
     /**
-     * Helper function to get all the possible moves for the current board
-     * configuration
+     * Helper function to get the best moves for the current board
+     * configuration. Every move is scored into a fixed per-cell array and the
+     * ones with the best score are returned. The line of every searched move
+     * is kept for the principal variation. The progress is reported after
+     * every root move and, if the search is cancelled, the best of the moves
+     * searched so far are returned.
      *
      * @param current_board The board to be analysed
-     * @return All the possible moves
+     * @return The cells of the best moves
      */
-    [[nodiscard]] auto Get_Possible_Moves(Utility::Board const & current_board) const
-    -> std::unordered_map<Move, Utility::Value, Move::Hash>;
+    [[nodiscard]] auto Get_Possible_Moves(BitBoard & current_board) noexcept -> BitBoard::mask;
 
  public:
 
     /**
      * [Constructor]
+     *
+     * @param mode How the best moves are found
      */
-    HardStrategy() noexcept = default;
+    explicit HardStrategy(Mode mode = Mode::TABLE) noexcept;
 
     /**
-     * Computes the best move for the current board configuration using the
-     * depth-unlimited alpha–beta pruning minimax algorithm.
+     * Computes the best move for the current board configuration, either by
+     * looking it up in the perfect-play table built at compile time or by
+     * using the depth-unlimited alpha–beta pruning minimax algorithm. The
+     * search is skipped for the first plies, which are found in the opening
+     * book. All of them give the same set of best moves, from which one is
+     * chosen at random.
      *
      * @param current_board The board to be analysed
      * @return The best move
@@ -261,6 +431,61 @@ class HardStrategy final : public IPlayerStrategy
      */
     [[gnu::pure]][[nodiscard]] auto GetName() const noexcept -> std::string_view final;
 
+    /**
+     * Gets the transposition table used by the search, e.g. to read its hit
+     * and miss counters.
+     *
+     * @return The transposition table
+     */
+    [[gnu::pure]][[nodiscard]] auto GetTranspositionTable() noexcept -> TranspositionTable &;
+
+    /**
+     * Gets the effort spent by the last call of GetNextMove(Board const &).
+     * Everything is 0 unless the statistics are enabled at build time.
+     *
+     * @return The statistics
+     */
+    [[gnu::pure]][[nodiscard]] auto GetSearchStatistics() const noexcept -> SearchStatistics const &;
+
+    /**
+     * Gets the line of best play that starts with the last move returned by
+     * GetNextMove(Board const &). In TABLE mode and for the moves found in
+     * the opening book it always reaches the end of the game; otherwise it can
+     * stop at a transposition table hit.
+     *
+     * @return The principal variation
+     */
+    [[gnu::pure]][[nodiscard]] auto GetPrincipalVariation() const noexcept -> Line const &;
+
+    /**
+     * Sets whether the search looks up the first plies in the opening book
+     * instead of searching them.
+     *
+     * @param enabled True or False
+     */
+    void SetOpeningBook(bool enabled) noexcept;
+
+    /**
+     * Gets whether the search looks up the first plies in the opening book.
+     *
+     * @return True or False
+     */
+    [[gnu::pure]][[nodiscard]] auto GetOpeningBook() const noexcept -> bool;
+
+    /**
+     * Sets the heuristics used by the search to order the moves.
+     *
+     * @param new_ordering The move ordering
+     */
+    void SetMoveOrdering(MoveOrdering new_ordering) noexcept;
+
+    /**
+     * Gets the heuristics used by the search to order the moves.
+     *
+     * @return The move ordering
+     */
+    [[gnu::pure]][[nodiscard]] auto GetMoveOrdering() const noexcept -> MoveOrdering;
+
     /**
      * [Destructor]
      */
@@ -287,6 +512,130 @@ class HardStrategy final : public IPlayerStrategy
     auto operator=(HardStrategy &&) -> HardStrategy & = default;
 };
 
+class MctsStrategy final : public IPlayerStrategy
+{
+ public:
+
+    /**
+     * Number of nodes of the search tree, configurable at build time.
+     */
+    static constexpr uint32_t NODES = TIC_TAC_TOE_MCTS_NODES;
+
+    /**
+     * Number of playouts per move if none is given.
+     */
+    static constexpr uint32_t DEFAULT_PLAYOUTS = 2'000;
+
+    /**
+     * Time in microseconds a move may take if none is given. The playouts are
+     * far slower on the device than on a host, so there the time bounds a
+     * move rather than the number of playouts.
+     */
+    static constexpr uint32_t DEFAULT_TIME_BUDGET = 500'000;
+
+    using Search = MonteCarloSearch<Utility::BOARD_SIZE, Utility::BOARD_SIZE, NODES>;
+
+ private:
+
+    /**
+     * Number of times the progress is reported during a move.
+     */
+    static constexpr uint8_t PROGRESS_STEPS = 8;
+
+    static_assert(sizeof(Search) <= 96 * 1024, "The search tree does not fit in SRAM");
+
+    /**
+     * Search tree shared by every instance, so that it is allocated once
+     * instead of with every new game. Only one instance may search at a time.
+     */
+    static inline Search search {};
+
+    uint32_t playouts;
+    uint32_t time_budget {DEFAULT_TIME_BUDGET};
+
+ public:
+
+    /**
+     * [Constructor]
+     *
+     * @param playouts The number of playouts per move, which sets the
+     *                 strength of the strategy
+     */
+    explicit MctsStrategy(uint32_t playouts = DEFAULT_PLAYOUTS) noexcept;
+
+    /**
+     * Selects the most visited move of a Monte Carlo tree search. The
+     * progress is reported every few playouts and, if the search is
+     * cancelled, the best move found so far is returned.
+     *
+     * @param current_board The board to be analysed
+     * @return A good move, better with more playouts
+     */
+    [[nodiscard]] auto GetNextMove(Utility::Board const & current_board) noexcept -> Move final;
+
+    /**
+     * Gets the strategy's name.
+     *
+     * @return A string representation of the strategy's name
+     */
+    [[gnu::pure]][[nodiscard]] auto GetName() const noexcept -> std::string_view final;
+
+    /**
+     * Sets the number of playouts per move. Fewer playouts make the strategy
+     * weaker, down to a random player.
+     *
+     * @param new_playouts The number of playouts, at least 1
+     */
+    void SetPlayouts(uint32_t new_playouts) noexcept;
+
+    /**
+     * Gets the number of playouts per move.
+     *
+     * @return The number of playouts
+     */
+    [[gnu::pure]][[nodiscard]] auto GetPlayouts() const noexcept -> uint32_t;
+
+    /**
+     * Sets the time a move may take, on top of its number of playouts.
+     * DEFAULT_TIME_BUDGET is used if none is given.
+     *
+     * @param microseconds The time budget, or Search::UNLIMITED_TIME
+     */
+    void SetTimeBudget(uint32_t microseconds) noexcept;
+
+    /**
+     * Gets the search of the last move, e.g. to read its playouts per second.
+     *
+     * @return The search
+     */
+    [[gnu::pure]][[nodiscard]] auto GetSearch() const noexcept -> Search const &;
+
+    /**
+     * [Destructor]
+     */
+    ~MctsStrategy() noexcept final = default;
+
+    /**
+     * [Copy constructor]
+     */
+    MctsStrategy(MctsStrategy const &) = default;
+
+    /**
+     * [Move constructor]
+     */
+    MctsStrategy(MctsStrategy &&) = default;
+
+    /**
+     * [Copy assigment operator]
+     */
+    auto operator=(MctsStrategy const &) -> MctsStrategy & = default;
+
+    /**
+     * [Move assigment operator]
+     */
+    auto operator=(MctsStrategy &&) -> MctsStrategy & = default;
+};
+
 class HumanStrategy final : public IPlayerStrategy
 {
  public:
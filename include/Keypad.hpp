@@ -9,7 +9,7 @@
 
 #pragma once
 
-#include <pico/multicore.h>
+#include <hardware/sync.h>
 #include <hardware/gpio.h>
 #include <pico/time.h>
 
@@ -18,7 +18,10 @@
 #include "Move.hpp"
 
 #include <cstdint>
+#include <utility>
+#include <atomic>
 #include <array>
+#include <bit>
 
 enum class Key
 {
@@ -26,11 +29,29 @@ enum class Key
     KEY5, KEY6, KEY7, KEY8,
     KEY9, KEY10, KEY11, KEY12,
     KEY13, KEY14, KEY15, KEY16,
-    UNKNOWN
+    UNKNOWN,
+    PROFILER_DUMP /* Request from the key interrupt to show the profiling results */
 };
 
+/**
+ * Matrix keypad read by interrupts: the rows are kept high, so pressing a key
+ * raises its column. The interrupt handler disables the column interrupts and
+ * sets an alarm that scans the rows every few milliseconds, queues each key
+ * once when it is pressed and enables the interrupts again once every key is
+ * released, so a held key is neither repeated nor keeps the core in the
+ * interrupt. The first core is never busy polling the keypad, so it only
+ * wakes up when a key is pressed.
+ */
 class Keypad final
 {
+ public:
+
+    /**
+     * Function that gets the first look at every key read. It returns true if
+     * it handled the key, which is then not returned to the game.
+     */
+    using KeyHandler = auto (*)(Key key) noexcept -> bool;
+
  private:
     using byte = uint8_t;
 
@@ -43,9 +64,59 @@ class Keypad final
     static constexpr bool LOW = false;
     static constexpr bool HIGH = true;
 
+    /**
+     * Time in milliseconds between two scans of the keypad while a key is
+     * held. The first scan comes this long after the rising edge, once the
+     * contact has stopped bouncing.
+     */
+    static constexpr uint32_t SCAN_TIME = 10;
+
+    /**
+     * Scans in a row that must find every key released before the column
+     * interrupts are enabled again, which filters the bounces of a release.
+     */
+    static constexpr byte RELEASE_SCANS = 2;
+
+    /**
+     * Number of keys that can wait to be read. The keys pressed while the
+     * queue is full are dropped.
+     */
+    static constexpr byte KEY_QUEUE_SIZE = 8;
+
+    /**
+     * Keys held together to show the profiling results (* and #).
+     */
+    static constexpr std::pair<Key, Key> PROFILER_CHORD {Key::KEY13, Key::KEY15};
+
     array rows;
     array columns;
 
+    /**
+     * The keypad whose interrupts are handled, since the SDK calls the GPIO
+     * interrupt handler without a context.
+     */
+    static inline Keypad const * interrupt_keypad {nullptr};
+
+    static inline KeyHandler key_handler {nullptr};
+
+    /**
+     * Keys written by the scan alarm and read by the first core. Each index
+     * is only written by one side, so no lock is needed.
+     */
+    static inline std::array<Key, KEY_QUEUE_SIZE> key_queue {};
+    static inline std::atomic<byte> queue_head {0};
+    static inline std::atomic<byte> queue_tail {0};
+
+    /**
+     * Set by the first rising edge and cleared once every key is released,
+     * while the column interrupts are disabled.
+     */
+    static inline std::atomic<bool> scanning {false};
+
+    static inline uint16_t held_keys {0};         /* Keys closed at the last scan, one bit per key */
+    static inline byte released_scans {0};        /* Scans in a row without any closed key */
+    static inline bool chord_queued {false};      /* The profiling request was queued for the held chord */
+
     static constexpr std::array<std::array<Key, KEYPAD_SIZE>, KEYPAD_SIZE>
             KEYS {{{Key::KEY1, Key::KEY2, Key::KEY3, Key::KEY4},
                    {Key::KEY5, Key::KEY6, Key::KEY7, Key::KEY8},
@@ -53,17 +124,89 @@ class Keypad final
                    {Key::KEY13, Key::KEY14, Key::KEY15, Key::KEY16}}};
 
     /**
-     * Initialises the arrays that contains the keypad pins.
+     * Initialises the arrays that contains the keypad pins and enables the
+     * interrupts of the columns.
      */
     inline void Init() noexcept;
 
     /**
-     * Polls the keypad to check if a button was pressed. It uses a software
-     * debounce method. If no key was pressed it returns unknown.
+     * Gets the bit of a key in a set of keys.
+     *
+     * @param key The key
+     * @return The bit
+     */
+    [[nodiscard]] static constexpr auto Key_Bit(Key key) noexcept -> uint16_t;
+
+    /**
+     * Enables or disables the rising edge interrupts of the columns.
+     *
+     * @param enabled True to enable them
+     */
+    void Set_Column_Interrupts(bool enabled) const noexcept;
+
+    /**
+     * Checks if any key is closed, by reading the columns while all the rows
+     * are high. Unlike a scan, it does not drive the rows.
      *
-     * @return The pressed key or unknown
+     * @return True or False
      */
-    [[nodiscard]] auto Key_Poller() const noexcept -> Key;
+    [[nodiscard]] auto Is_Any_Closed() const noexcept -> bool;
+
+    /**
+     * Checks if the contact between a row and a column is closed by driving
+     * only that row high. The rows are all high again afterwards.
+     *
+     * @param row The row index
+     * @param column The column index
+     * @return True or False
+     */
+    [[nodiscard]] auto Is_Closed(size_t row, size_t column) const noexcept -> bool;
+
+    /**
+     * Finds every closed key. Only the columns raised while all the rows are
+     * high are scanned row by row.
+     *
+     * @return The closed keys, one bit per key
+     */
+    [[nodiscard]] auto Scan() const noexcept -> uint16_t;
+
+    /**
+     * Adds a key to the queue, unless the queue is full.
+     *
+     * @param key The key
+     */
+    static void Push_Key(Key key) noexcept;
+
+    /**
+     * Queues the keys pressed since the previous scan. With the profiling
+     * instrumentation, a key of the chord is only queued when it is released
+     * without the other one, and holding both queues a single request to show
+     * the profiling results.
+     *
+     * @param closed The keys closed now, one bit per key
+     */
+    static void Queue_Changes(uint16_t closed) noexcept;
+
+    /**
+     * Handler of the scan alarm. It scans the keypad every SCAN_TIME until
+     * every key is released, then enables the column interrupts again.
+     *
+     * @param id The alarm
+     * @param user_data Unused
+     * @return The time until the next scan in microseconds, or 0 once every
+     *         key is released
+     */
+    static auto Scan_Alarm_Handler(alarm_id_t id, void * user_data) noexcept -> int64_t;
+
+    /**
+     * Handler of the rising edges of the columns. It runs on the first core.
+     * A scan drives the rows, which raises the columns of the held keys again,
+     * so the column interrupts stay disabled while the scan alarm runs.
+     *
+     * @param gpio The pin of the column
+     * @param event_mask The events
+     */
+    static void Key_Interrupt_Handler(uint gpio, uint32_t event_mask) noexcept;
 
  public:
 
@@ -76,14 +219,25 @@ class Keypad final
     Keypad(array const & rows, array const & columns) noexcept;
 
     /**
-     * Blocks the execution until a key is pressed.
+     * Sets the function that gets the first look at every key read, e.g. to
+     * handle the keys that work at any time.
      *
-     * @return The pressed key
+     * @param handler The handler, or nullptr
+     */
+    static void SetKeyHandler(KeyHandler handler) noexcept;
+
+    /**
+     * Gets the next pressed key from the queue without waiting. A request to
+     * show the profiling results and the keys taken by the key handler are
+     * handled here and not returned.
+     *
+     * @return The pressed key or unknown if there is none
      */
-    [[nodiscard]] auto GetKeyFromPoller() const noexcept -> Key;
+    [[nodiscard]] static auto GetKey() noexcept -> Key;
 
     /**
-     * Gets the pressed key from the intercore FIFO.
+     * Waits for a key to be pressed, sleeping in between. The profiling
+     * results stay on the screen until the game draws over them.
      *
      * @return The pressed key
      */
@@ -130,3 +284,7 @@ class Keypad final
     static auto AnswerFromKey(Key key) noexcept -> std::string_view;
 };
 
+constexpr auto Keypad::Key_Bit(Key key) noexcept -> uint16_t
+{
+    return static_cast<uint16_t>(1U << static_cast<uint>(key));
+}
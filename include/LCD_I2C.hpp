@@ -9,13 +9,30 @@
 
 #pragma once
 
-#include <hardware/gpio.h>
-#include <hardware/i2c.h>
+#include "I2CBus.hpp"
 
 #include <string_view>
 #include <cstdint>
+#include <atomic>
 #include <array>
-
+#include <span>
+
+#ifndef TIC_TAC_TOE_LCD_BUSY_FLAG
+#define TIC_TAC_TOE_LCD_BUSY_FLAG 0
+#endif
+
+/**
+ * Driver of a HD44780 character LCD behind a PCF8574 I2C expander. The text
+ * is written into a shadow framebuffer in RAM and Flush() sends only the cells
+ * that changed since the previous flush, so redrawing an unchanged screen
+ * costs no bus traffic. The expander bytes are appended to a lock-free queue
+ * that the I2C bus sends in the background, so updating the screen does not
+ * wait for the bus, which the display can share with other devices. Every
+ * instruction is followed by enough bus time for the display to execute it,
+ * from the execution times of the HD44780 datasheet, or, when the
+ * TIC_TAC_TOE_LCD_BUSY_FLAG build option is on, the slow instructions wait for
+ * the busy flag instead.
+ */
 class LCD_I2C final
 {
  private:
@@ -70,6 +87,12 @@ class LCD_I2C final
     static constexpr byte BACKLIGHT = 0x08;
     static constexpr byte NO_BACKLIGHT = 0x00;
 
+    // Execution times in microseconds
+
+    static constexpr uint16_t INSTRUCTION_TIME = 37;
+    static constexpr uint16_t DATA_TIME = 37 + 4;   /* The address counter is updated after the write */
+    static constexpr uint16_t SLOW_TIME = 1'520;    /* Clear display and return home */
+
     // Special flags
 
     static constexpr byte ENABLE = 0x04;
@@ -83,9 +106,35 @@ class LCD_I2C final
     static constexpr byte CUSTOM_SYMBOL_SIZE = 8;
     using array = std::array<byte, CUSTOM_SYMBOL_SIZE>;
 
+    /**
+     * Largest display held by the framebuffer.
+     */
+    static constexpr byte MAX_COLUMNS = 20;
+    static constexpr byte MAX_ROWS = 4;
+
+    /**
+     * Fastest I2C speed the PCF8574 expander is rated for, in bits per
+     * second.
+     */
+    static constexpr uint MAX_BUS_SPEED = 100'000;
+
  private:
 
-    byte address {};
+    using frame = std::array<byte, MAX_ROWS * MAX_COLUMNS>;
+
+    /**
+     * Marks the address counter of the display as unknown.
+     */
+    static constexpr byte NO_ADDRESS = 0xFF;
+
+    /**
+     * Expander bytes waiting to be sent, a power of two. A full screen takes
+     * about 500 bytes.
+     */
+    static constexpr size_t QUEUE_SIZE = 512;
+
+    using entry = I2CBus::entry;
+
     byte columns {};
     byte rows {};
     byte backlight {};
@@ -93,61 +142,133 @@ class LCD_I2C final
     byte display_control {};
     byte display_mode {};
 
-    i2c_inst * I2C_instance {nullptr};
+    I2CBus * bus {nullptr};
+    I2CBus::device device {I2CBus::NO_DEVICE};
+
+    byte last_port {0xFF};                /* Last byte queued to the expander */
+
+    std::array<entry, QUEUE_SIZE> queue {};
+    std::atomic<size_t> queue_head {0};   /* Written by the callers */
+    std::atomic<size_t> queue_tail {0};   /* Written by the DMA interrupt */
+    std::atomic<bool> sending {false};    /* A transfer is owned by the bus */
+    size_t sending_length {0};
+    critical_section_t sending_lock {};   /* Guards the taking of the transfer */
+
+    frame framebuffer {};                 /* Written by the callers */
+    frame displayed {};                   /* Last sent to the display */
+    frame overlay {};                     /* Shown instead of the framebuffer */
+    bool overlay_shown {false};
+    byte cursor_row {0};
+    byte cursor_column {0};
+    byte display_address {NO_ADDRESS};    /* Address counter of the display */
+
+    /**
+     * Handles the end of a transfer sent by the bus: releases its entries and
+     * starts the transfer of the ones queued meanwhile.
+     *
+     * @param context The display
+     */
+    static void Handle_Transfer_Done(void * context) noexcept;
 
     /**
-     * Wrapper function for SDK's internal I2C protocol write function.
+     * Appends an expander byte to the queue, waiting for room if it is full.
      *
      * @param val Value to be written
      */
-    inline void I2C_Write_Byte(byte val) const noexcept;
+    inline void Push(byte val) noexcept;
 
     /**
-     * Creates a short impulse on the enable pin of the LCD.
+     * Queues a single expander byte and starts sending it.
      *
-     * @param val Value to be written along with the pulse
+     * @param val Value to be written
      */
-    void Pulse_Enable(byte val) const noexcept;
+    inline void I2C_Write_Byte(byte val) noexcept;
 
     /**
-     * Sends a nibble of data using the I2C protocol.
+     * Gets the time the display takes to execute an instruction or a data
+     * write, from the HD44780 datasheet.
+     *
+     * @param val The instruction or data byte
+     * @param mode The mode used when sending
+     * @return The execution time in microseconds
+     */
+    [[nodiscard]] static constexpr auto Get_Execution_Time(byte val, byte mode) noexcept -> uint16_t;
+
+    /**
+     * Computes the idle bytes to send after a byte so that the display has
+     * finished executing it when the enable pin rises again.
+     *
+     * @param execution_time The execution time in microseconds
+     * @return The number of idle bytes
+     */
+    [[nodiscard]] inline auto Get_Idle_Bytes(uint16_t execution_time) const noexcept -> uint32_t;
+
+    /**
+     * Appends a nibble of data to the queue: the nibble is latched by a high
+     * and a low level on the enable pin, after a byte setting up the register
+     * select and read/write lines if they change. The time the bus takes to
+     * shift out the bytes is the enable pulse, so no delay is needed.
      *
      * @param val Value to be sent
      */
-    inline void Send_Nibble(byte val) const noexcept;
+    inline void Queue_Nibble(byte val) noexcept;
 
     /**
-     * Send a byte of data as two nibbles using the function
-     * Send_Nibble(byte val).
+     * Appends a byte of data to the queue as two nibbles using the
+     * function Queue_Nibble(byte val), followed by enough idle bytes for the
+     * display to execute it.
      *
      * @param val Value to be sent
      * @param mode The mode used when sending
      */
-    inline void Send_Byte(byte val, byte mode) const noexcept;
+    inline void Queue_Byte(byte val, byte mode) noexcept;
 
     /**
-     * Sends a command to the LCD display using the function
-     * Send_Byte(byte val, byte mode).
+     * Appends a command to the queue using the function
+     * Queue_Byte(byte val, byte mode).
      *
      * @param val Value to be sent
      */
-    inline void Send_Command(byte val) const noexcept;
+    inline void Queue_Command(byte val) noexcept;
 
     /**
-     * Sends a character to the LCD display using the function
-     * Send_Byte(byte val, byte mode).
+     * Appends a character, or a line of a custom character, to the queue
+     * using the function Queue_Byte(byte val, byte mode).
      *
      * @param val Value to be sent
      */
-    inline void Send_Char(byte val) const noexcept;
+    inline void Queue_Char(byte val) noexcept;
 
     /**
-     * Sends an address or line of a custom character to the LCD display using
-     * the function Send_Byte(byte val, byte mode).
+     * Hands the queued bytes up to the end of the queue storage to the DMA
+     * channel as one I2C transaction, unless a transfer is already running.
+     * It is called both by the callers and by the DMA interrupt.
+     */
+    void Start_Transfer() noexcept;
+
+    /**
+     * Takes the transfer if no other one is owned by the bus. The flag is
+     * tested and set in a critical section, which also holds off the
+     * interrupt that clears it.
+     *
+     * @return True if the transfer was taken
+     */
+    [[nodiscard]] auto Try_Take_Transfer() noexcept -> bool;
+
+    /**
+     * Sends a command to the LCD display.
      *
      * @param val Value to be sent
      */
-    inline void Send_Register_Select(byte val) const noexcept;
+    void Send_Command(byte val) noexcept;
+
+#if TIC_TAC_TOE_LCD_BUSY_FLAG
+    /**
+     * Waits until the display clears its busy flag, read through the
+     * expander. The queue must be empty.
+     */
+    void Wait_Until_Ready() noexcept;
+#endif
 
     /**
      * Establishes communication with the LCD using the I2C protocol and sets
@@ -156,21 +277,37 @@ class LCD_I2C final
      */
     inline void Init() noexcept;
 
+    /**
+     * Computes the DDRAM address of a cell.
+     *
+     * @param row The vertical position (Y axis)
+     * @param column The horizontal position (X axis)
+     * @return The address
+     */
+    [[nodiscard]] inline auto Get_Address(byte row, byte column) const noexcept -> byte;
+
+    /**
+     * Writes a character into the framebuffer at the cursor position and
+     * moves the cursor in the direction of the text. Characters past the end
+     * of the row are dropped.
+     *
+     * @param character The character to be written
+     */
+    inline void Put_Char(byte character) noexcept;
+
  public:
 
     /**
-     * [Constructor] Initialises the I2C communication protocol using the
-     * provided instance and pins and calls the display's Init() function.
+     * [Constructor] Adds the display to an I2C bus, rated for MAX_BUS_SPEED,
+     * and calls the display's Init() function. The bus must outlive the
+     * display.
      *
+     * @param bus The I2C bus
      * @param address The I2C address
      * @param columns The LCD's number of columns
      * @param rows The LCD's number of rows
-     * @param I2C The I2C instance
-     * @param SDA The serial data pin
-     * @param SCL The serial clock pin
      */
-    LCD_I2C(byte address, byte columns, byte rows, i2c_inst * I2C = PICO_DEFAULT_I2C_INSTANCE,
-            uint SDA = PICO_DEFAULT_I2C_SDA_PIN, uint SCL = PICO_DEFAULT_I2C_SCL_PIN) noexcept;
+    LCD_I2C(I2CBus * bus, byte address, byte columns, byte rows) noexcept;
 
     /**
      * Turns the display on.
@@ -230,46 +367,48 @@ class LCD_I2C final
     void SetTextRightToLeft() noexcept;
 
     /**
-     * Clears the display and sets cursor's position at the beginning of the
-     * screen.
+     * Clears the display and the framebuffer and sets cursor's position at
+     * the beginning of the screen.
      */
-    void Clear() const noexcept;
+    void Clear() noexcept;
 
     /**
      * Sets cursor's position at the beginning of the screen.
      */
-    void Home() const noexcept;
+    void Home() noexcept;
 
     /**
-     * Sets the display's cursor to the position defined by the @p row and
+     * Sets the framebuffer's cursor to the position defined by the @p row and
      * @p column.
      *
      * @param row The vertical position (Y axis)
      * @param column The horizontal position (X axis)
      */
-    void SetCursor(byte row, byte column) const noexcept;
+    void SetCursor(byte row, byte column) noexcept;
 
     /**
-     * Prints the character on the display at the current cursor position.
+     * Writes the character into the framebuffer at the current cursor
+     * position.
      *
      * @param character The character to be printed
      */
-    void PrintChar(byte character) const noexcept;
+    void PrintChar(byte character) noexcept;
 
     /**
-     * Prints the string on the display starting at the current cursor position.
+     * Writes the string into the framebuffer starting at the current cursor
+     * position.
      *
      * @param str The string to be printed
      */
-    void PrintString(std::string_view str) const noexcept;
+    void PrintString(std::string_view str) noexcept;
 
     /**
-     * Prints the custom character on the display at the current cursor
+     * Writes the custom character into the framebuffer at the current cursor
      * position, by specifying the location in memory.
      *
      * @param location The memory address
      */
-    void PrintCustomChar(byte location) const noexcept;
+    void PrintCustomChar(byte location) noexcept;
 
     /**
      * Creates a custom character by specifying the location in memory to be
@@ -281,6 +420,48 @@ class LCD_I2C final
      * @param location The memory address
      * @param char_map The byte array
      */
-    void CreateCustomChar(byte location, array char_map) const noexcept;
+    void CreateCustomChar(byte location, array char_map) noexcept;
+
+    /**
+     * Queues the cells of the framebuffer that changed since the previous
+     * flush and returns without waiting for the bus. Consecutive changed
+     * cells are sent after a single cursor command, relying on the display
+     * moving its cursor after every character.
+     */
+    void Flush() noexcept;
+
+    /**
+     * Shows a screen on top of the framebuffer, which keeps every write made
+     * meanwhile and is shown again by HideOverlay(). Lines past the number of
+     * rows and characters past the end of a row are dropped.
+     *
+     * @param lines The lines of the screen, from the top
+     */
+    void ShowOverlay(std::span<std::string_view const> lines) noexcept;
+
+    /**
+     * Hides the overlay and shows the framebuffer again, as it is now.
+     */
+    void HideOverlay() noexcept;
+
+    /**
+     * Checks if an overlay is shown.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] auto IsOverlayShown() const noexcept -> bool;
+
+    /**
+     * Checks if every queued byte has been sent.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] auto IsIdle() const noexcept -> bool;
+
+    /**
+     * Waits until every queued byte has been sent and the I2C bus has
+     * finished the last transaction.
+     */
+    void WaitForIdle() const noexcept;
 };
 
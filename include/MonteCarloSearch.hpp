@@ -0,0 +1,488 @@
+/*******************************************************************************
+ * @file MonteCarloSearch.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the MonteCarloSearch class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <pico/time.h>
+
+#include "GridBoard.hpp"
+
+#include <cstdint>
+#include <cmath>
+#include <array>
+
+/**
+ * Monte Carlo tree search for the boards of any size. Every playout walks
+ * down the tree choosing the child with the best upper confidence bound
+ * (UCT), expands the leaf it reaches, finishes the game with random moves and
+ * adds the result to every node on its path. Unlike GridSearch, it needs no
+ * evaluator and its strength only depends on the number of playouts, so it
+ * degrades gracefully from a near-perfect player to a random one.
+ *
+ * The nodes live in a fixed arena inside the object, so a search never
+ * allocates. All the children of a node are created together and stored next
+ * to each other; once the arena is full the tree stops growing and the
+ * playouts start from its leaves.
+ *
+ * @tparam N The number of rows and columns
+ * @tparam K The number of pieces in a row needed to win
+ * @tparam NODES The number of nodes of the arena
+ */
+template <uint8_t N, uint8_t K, uint32_t NODES>
+class MonteCarloSearch final
+{
+ public:
+
+    using Board = GridBoard<N, K>;
+    using cell = typename Board::cell;
+
+    /**
+     * Time budget that lets the search run all its playouts.
+     */
+    static constexpr uint32_t UNLIMITED_TIME = 0;
+
+    /**
+     * Number of playouts between two reads of the clock.
+     */
+    static constexpr uint32_t TIME_CHECK_INTERVAL = 64;
+
+    /**
+     * Most visited move of the root.
+     */
+    struct Result
+    {
+        cell move {Board::CELLS}; /* The best cell, or CELLS if the game is over */
+        uint32_t visits {0};      /* The number of playouts through the move */
+        float win_rate {0};       /* The mean result of the move, 1 for a win and 0.5 for a draw */
+    };
+
+ private:
+
+    static_assert(NODES > Board::CELLS, "The arena must hold at least the root and its children");
+
+    /**
+     * Results of a playout, counted in half points so that draws stay
+     * integers.
+     */
+    static constexpr uint8_t WIN_REWARD = 2;
+    static constexpr uint8_t DRAW_REWARD = 1;
+
+    /**
+     * Exploration constant of UCT: sqrt(2), for rewards between 0 and 1.
+     */
+    static constexpr float EXPLORATION = 1.41421356F;
+
+    static constexpr uint64_t NO_DEADLINE = UINT64_MAX;
+
+    /**
+     * Position reached by a move, from the point of view of the player who
+     * made it.
+     */
+    struct Node
+    {
+        uint32_t first_child {0}; /* The index of the first child, or 0 if the node is not expanded */
+        uint32_t visits {0};      /* The number of playouts through the node */
+        uint32_t reward {0};      /* The sum of the results of those playouts, in half points */
+        cell move {0};            /* The cell of the move */
+        cell child_count {0};     /* The number of children */
+    };
+
+    std::array<Node, NODES> nodes {};
+    uint32_t node_count {0};
+
+    Board root {};
+    bool root_over {false};
+    uint64_t random_state {0x853C'49E6'748F'EA9B};
+
+    uint32_t time_budget {UNLIMITED_TIME};
+    uint64_t start {0};
+    uint64_t deadline {NO_DEADLINE};
+
+    uint32_t playout_count {0};
+    uint32_t elapsed {0};
+
+    /**
+     * Gets a random number below a bound (xorshift64*).
+     *
+     * @param bound The bound, at least 1
+     * @return The number
+     */
+    [[nodiscard]] auto Get_Random(cell bound) noexcept -> cell;
+
+    /**
+     * Chooses the child of a node with the best upper confidence bound. The
+     * children that were never visited are chosen first, in order.
+     *
+     * @param parent The index of the node
+     * @return The index of the child
+     */
+    [[nodiscard]] auto Select_Child(uint32_t parent) const noexcept -> uint32_t;
+
+    /**
+     * Creates the children of a node, one per empty cell, if they fit in the
+     * arena.
+     *
+     * @param parent The index of the node
+     * @param current_board The position of the node
+     * @return True if the node was expanded
+     */
+    auto Expand(uint32_t parent, Board const & current_board) noexcept -> bool;
+
+    /**
+     * Finishes a game with random moves.
+     *
+     * @param current_board The position to start from, changed in place
+     * @return The winner, or UNK for a draw
+     */
+    [[nodiscard]] auto Play_Out(Board & current_board) noexcept -> Utility::PlayerSymbol;
+
+    /**
+     * Runs one playout from the root: selection, expansion, simulation and
+     * backpropagation.
+     */
+    void Run_Playout() noexcept;
+
+ public:
+
+    /**
+     * [Constructor]
+     */
+    MonteCarloSearch() noexcept = default;
+
+    /**
+     * Seeds the random number generator of the playouts.
+     *
+     * @param seed The seed
+     */
+    void SetSeed(uint64_t seed) noexcept;
+
+    /**
+     * Sets the time a search may take, on top of its number of playouts.
+     *
+     * @param microseconds The time budget, or UNLIMITED_TIME
+     */
+    void SetTimeBudget(uint32_t microseconds) noexcept;
+
+    /**
+     * Gets the time a search may take.
+     *
+     * @return The time budget in microseconds
+     */
+    [[nodiscard]] auto GetTimeBudget() const noexcept -> uint32_t;
+
+    /**
+     * Starts a new search, dropping the tree of the last one, and starts the
+     * clock of the time budget.
+     *
+     * @param current_board The position to be analysed
+     */
+    void Reset(Board const & current_board) noexcept;
+
+    /**
+     * Adds playouts to the tree of the current search. Nothing is done if the
+     * game is already over.
+     *
+     * @param playouts The number of playouts
+     * @return False if the time budget ran out first
+     */
+    auto Run(uint32_t playouts) noexcept -> bool;
+
+    /**
+     * Gets the most visited move of the root so far. The first of the equally
+     * visited moves is returned.
+     *
+     * @return The move and its statistics
+     */
+    [[nodiscard]] auto GetBestMove() const noexcept -> Result;
+
+    /**
+     * Runs a whole search: the given number of playouts, or fewer if the time
+     * budget runs out first.
+     *
+     * @param current_board The position to be analysed
+     * @param playouts The number of playouts
+     * @return The most visited move
+     */
+    [[nodiscard]] auto Search(Board const & current_board, uint32_t playouts) noexcept -> Result;
+
+    /**
+     * Gets the number of playouts of the current search.
+     *
+     * @return The number of playouts
+     */
+    [[nodiscard]] auto GetPlayouts() const noexcept -> uint32_t;
+
+    /**
+     * Gets the number of nodes of the tree of the current search.
+     *
+     * @return The number of nodes
+     */
+    [[nodiscard]] auto GetNodeCount() const noexcept -> uint32_t;
+
+    /**
+     * Gets the time spent on the playouts of the current search.
+     *
+     * @return The time in microseconds
+     */
+    [[nodiscard]] auto GetElapsed() const noexcept -> uint32_t;
+
+    /**
+     * Computes the speed of the playouts of the current search.
+     *
+     * @return The number of playouts per second, or 0 before any playout
+     */
+    [[nodiscard]] auto GetPlayoutsPerSecond() const noexcept -> uint32_t;
+};
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::Get_Random(cell bound) noexcept -> cell
+{
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    auto const RANDOM = static_cast<uint32_t>((random_state * 0x2545'F491'4F6C'DD1D) >> 32);
+
+    // Maps the number to the range with a multiplication instead of a division
+    return static_cast<cell>((uint64_t {RANDOM} * bound) >> 32);
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::Select_Child(uint32_t parent) const noexcept -> uint32_t
+{
+    auto const & PARENT = nodes[parent];
+    auto const LOG_VISITS = std::log(static_cast<float>(PARENT.visits));
+
+    auto best_child = PARENT.first_child;
+    auto best_bound = -1.0F;
+
+    for (auto child = PARENT.first_child; child < PARENT.first_child + PARENT.child_count; ++child)
+    {
+        auto const & CHILD = nodes[child];
+        if (CHILD.visits == 0)
+        {
+            return child;
+        }
+
+        auto const VISITS = static_cast<float>(CHILD.visits);
+        auto const BOUND = static_cast<float>(CHILD.reward) / (WIN_REWARD * VISITS) +
+                           EXPLORATION * std::sqrt(LOG_VISITS / VISITS);
+        if (BOUND > best_bound)
+        {
+            best_bound = BOUND;
+            best_child = child;
+        }
+    }
+    return best_child;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::Expand(uint32_t parent, Board const & current_board) noexcept -> bool
+{
+    auto const MOVES = current_board.GetMoves();
+    if (node_count + MOVES.GetSize() > NODES)
+    {
+        return false;
+    }
+
+    nodes[parent].first_child = node_count;
+    nodes[parent].child_count = MOVES.GetSize();
+    for (auto const CELL: MOVES)
+    {
+        nodes[node_count++] = {0, 0, 0, CELL, 0};
+    }
+    return true;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::Play_Out(Board & current_board) noexcept -> Utility::PlayerSymbol
+{
+    auto moves = current_board.GetMoves();
+    auto remaining = moves.GetSize();
+    auto player = current_board.GetCurrentPlayer();
+
+    while (remaining != 0)
+    {
+        // Takes a random move out of the list by moving the last one in its place
+        auto const INDEX = Get_Random(remaining);
+        auto const CELL = moves[INDEX];
+        moves[INDEX] = moves[--remaining];
+
+        if (current_board.IsWinningMove(CELL, player))
+        {
+            return player;
+        }
+        current_board.MakeMove(CELL, player);
+        player = (player == Utility::PlayerSymbol::X) ? Utility::PlayerSymbol::O : Utility::PlayerSymbol::X;
+    }
+    return Utility::PlayerSymbol::UNK;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+void MonteCarloSearch<N, K, NODES>::Run_Playout() noexcept
+{
+    std::array<uint32_t, Board::CELLS + 1> path {};
+    cell length = 0;
+
+    auto board = root;
+    uint32_t node = 0;
+    auto winner = Utility::PlayerSymbol::UNK;
+    bool over = false;
+
+    path[length++] = node;
+
+    // Selection and expansion: walk down until a node that was never visited
+    while (!over && !board.IsFull())
+    {
+        // A new node is only expanded on its second visit, which keeps the
+        // leaves that are never visited again out of the arena
+        if (nodes[node].first_child == 0 && ((node != 0 && nodes[node].visits == 0) || !Expand(node, board)))
+        {
+            break;
+        }
+
+        node = Select_Child(node);
+        path[length++] = node;
+
+        auto const PLAYER = board.GetCurrentPlayer();
+        if (board.IsWinningMove(nodes[node].move, PLAYER))
+        {
+            winner = PLAYER;
+            over = true;
+        }
+        board.MakeMove(nodes[node].move, PLAYER);
+    }
+
+    // Simulation
+    if (!over)
+    {
+        winner = Play_Out(board);
+    }
+
+    // Backpropagation: every node is scored for the player who moved into it,
+    // and the players alternate along the path
+    auto mover = (root.GetCurrentPlayer() == Utility::PlayerSymbol::X) ? Utility::PlayerSymbol::O :
+                 Utility::PlayerSymbol::X;
+    for (cell index = 0; index < length; ++index)
+    {
+        auto & visited = nodes[path[index]];
+        ++visited.visits;
+        visited.reward += (winner == Utility::PlayerSymbol::UNK) ? DRAW_REWARD :
+                          static_cast<uint8_t>((winner == mover) ? WIN_REWARD : 0);
+        mover = (mover == Utility::PlayerSymbol::X) ? Utility::PlayerSymbol::O : Utility::PlayerSymbol::X;
+    }
+    ++playout_count;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+void MonteCarloSearch<N, K, NODES>::SetSeed(uint64_t seed) noexcept
+{
+    // The state of xorshift must never be 0
+    random_state = (seed != 0) ? seed : 0x853C'49E6'748F'EA9B;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+void MonteCarloSearch<N, K, NODES>::SetTimeBudget(uint32_t microseconds) noexcept
+{
+    time_budget = microseconds;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::GetTimeBudget() const noexcept -> uint32_t
+{
+    return time_budget;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+void MonteCarloSearch<N, K, NODES>::Reset(Board const & current_board) noexcept
+{
+    root = current_board;
+    root_over = current_board.IsFull() || current_board.IsWinner(Utility::PlayerSymbol::X) ||
+                current_board.IsWinner(Utility::PlayerSymbol::O);
+    nodes[0] = {};
+    node_count = 1;
+    playout_count = 0;
+    elapsed = 0;
+
+    start = time_us_64();
+    deadline = (time_budget == UNLIMITED_TIME) ? NO_DEADLINE : start + time_budget;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::Run(uint32_t playouts) noexcept -> bool
+{
+    bool in_time = true;
+
+    for (uint32_t playout = 0; playout < playouts && !root_over; ++playout)
+    {
+        if (playout_count % TIME_CHECK_INTERVAL == 0 && time_us_64() >= deadline)
+        {
+            in_time = false;
+            break;
+        }
+        Run_Playout();
+    }
+
+    elapsed = static_cast<uint32_t>(time_us_64() - start);
+    return in_time;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::GetBestMove() const noexcept -> Result
+{
+    auto const & ROOT = nodes[0];
+
+    Result result {};
+    for (auto child = ROOT.first_child; ROOT.first_child != 0 && child < ROOT.first_child + ROOT.child_count; ++child)
+    {
+        auto const & CHILD = nodes[child];
+        if (result.move == Board::CELLS || CHILD.visits > result.visits)
+        {
+            result = {CHILD.move, CHILD.visits,
+                      (CHILD.visits == 0) ? 0.0F :
+                      static_cast<float>(CHILD.reward) / static_cast<float>(WIN_REWARD * CHILD.visits)};
+        }
+    }
+    return result;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::Search(Board const & current_board, uint32_t playouts) noexcept -> Result
+{
+    Reset(current_board);
+    Run(playouts);
+    return GetBestMove();
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::GetPlayouts() const noexcept -> uint32_t
+{
+    return playout_count;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::GetNodeCount() const noexcept -> uint32_t
+{
+    return node_count;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::GetElapsed() const noexcept -> uint32_t
+{
+    return elapsed;
+}
+
+template <uint8_t N, uint8_t K, uint32_t NODES>
+auto MonteCarloSearch<N, K, NODES>::GetPlayoutsPerSecond() const noexcept -> uint32_t
+{
+    if (elapsed == 0)
+    {
+        return 0;
+    }
+    return static_cast<uint32_t>(uint64_t {playout_count} * 1'000'000 / elapsed);
+}
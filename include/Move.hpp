@@ -55,10 +55,5 @@ class Move
      * @return True if the objects are the same, false otherwise
      */
     friend auto operator==(Move const & lhs, Move const & rhs) noexcept -> bool;
-
-    struct Hash
-    {
-        [[gnu::pure]] auto operator()(Move const & action) const noexcept -> std::size_t;
-    };
 };
 
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * @file MoveList.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the MoveList class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "BitBoard.hpp"
+#include "Move.hpp"
+
+#include <cstdint>
+#include <array>
+
+/**
+ * Fixed-capacity list of moves that lives on the stack, so building and
+ * copying it never touches the heap.
+ */
+class MoveList final
+{
+ public:
+
+    static constexpr uint8_t CAPACITY = BitBoard::CELLS;
+
+    using iterator = std::array<Move, CAPACITY>::const_iterator;
+
+ private:
+
+    std::array<Move, CAPACITY> moves {};
+    uint8_t size {0};
+
+ public:
+
+    /**
+     * [Constructor] Creates an empty list.
+     */
+    MoveList() noexcept = default;
+
+    /**
+     * [Constructor] Creates a list with the moves on the cells of a mask, in
+     * row-major order.
+     *
+     * @param cells The cells mask
+     */
+    explicit MoveList(BitBoard::mask cells) noexcept;
+
+    /**
+     * Appends a move to the list. Moves past the capacity are ignored.
+     *
+     * @param action The move to be added
+     */
+    void Add(Move const & action) noexcept;
+
+    /**
+     * Gets the number of moves in the list.
+     *
+     * @return The number of moves
+     */
+    [[gnu::pure]][[nodiscard]] auto GetSize() const noexcept -> uint8_t;
+
+    /**
+     * Checks if the list has no moves.
+     *
+     * @return True or False
+     */
+    [[gnu::pure]][[nodiscard]] auto IsEmpty() const noexcept -> bool;
+
+    /**
+     * [Subscript operator] Gets a move from the list.
+     *
+     * @param index The position of the move
+     * @return The move
+     */
+    [[gnu::pure]][[nodiscard]] auto operator[](uint8_t index) const noexcept -> Move const &;
+
+    /**
+     * Gets an iterator to the first move.
+     *
+     * @return The iterator
+     */
+    [[gnu::pure]][[nodiscard]] auto begin() const noexcept -> iterator;
+
+    /**
+     * Gets an iterator past the last move.
+     *
+     * @return The iterator
+     */
+    [[gnu::pure]][[nodiscard]] auto end() const noexcept -> iterator;
+};
@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * @file MoveOrdering.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the move ordering heuristics of the searches.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "Utility.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+/**
+ * How the moves of a position are ordered before being searched. Every level
+ * adds a heuristic to the ones of the previous level, so the benchmark can
+ * measure what each of them saves.
+ */
+enum class MoveOrdering : uint8_t
+{
+    NONE,    /* Row-major order */
+    STATIC,  /* Winning moves, then blocking moves, then the cells on the most lines (centre > corner > edge) */
+    KILLERS, /* The moves that caused the last two cutoffs at the same ply come next */
+    HISTORY  /* The moves that caused the most cutoffs anywhere in the tree come next */
+};
+
+/**
+ * Keeps the killer moves and the history table of a search and scores the
+ * moves of a position with them. Everything lives inside the object, so it
+ * never allocates.
+ *
+ * @tparam CELLS The number of cells of the board
+ * @tparam PLIES The number of plies that can be searched below the root
+ */
+template <uint16_t CELLS, uint8_t PLIES>
+class MoveOrderer final
+{
+ public:
+
+    using cell = uint16_t;
+    using score = int32_t;
+
+    /**
+     * Whether a move ends the game.
+     */
+    enum class Tactic : uint8_t
+    {
+        QUIET, /* Neither wins nor stops a win */
+        BLOCK, /* Stops the opponent from winning on the next move */
+        WIN    /* Wins the game */
+    };
+
+ private:
+
+    static constexpr cell NO_MOVE = CELLS;
+
+    static constexpr score WIN_BONUS = score {1} << 30;
+    static constexpr score BLOCK_BONUS = score {1} << 29;
+    static constexpr std::array<score, 2> KILLER_BONUSES {score {1} << 28, score {1} << 27};
+
+    static constexpr uint8_t HISTORY_SHIFT = 6;
+    static constexpr uint32_t HISTORY_MAX = (uint32_t {1} << 20) - 1;
+
+    MoveOrdering ordering;
+
+    std::array<std::array<cell, 2>, PLIES> killers {};
+    std::array<std::array<uint32_t, CELLS>, 2> history {};
+
+    /**
+     * Gets the index of the history table of a player.
+     *
+     * @param player The player
+     * @return The index
+     */
+    [[nodiscard]] static constexpr auto Get_Player_Index(Utility::PlayerSymbol player) noexcept -> size_t;
+
+ public:
+
+    /**
+     * [Constructor]
+     *
+     * @param ordering The heuristics used
+     */
+    explicit constexpr MoveOrderer(MoveOrdering ordering) noexcept;
+
+    /**
+     * Sets the heuristics used.
+     *
+     * @param new_ordering The move ordering
+     */
+    constexpr void SetOrdering(MoveOrdering new_ordering) noexcept;
+
+    /**
+     * Gets the heuristics used.
+     *
+     * @return The move ordering
+     */
+    [[nodiscard]] constexpr auto GetOrdering() const noexcept -> MoveOrdering;
+
+    /**
+     * Forgets the killer moves and the history, e.g. before a new search.
+     */
+    constexpr void Clear() noexcept;
+
+    /**
+     * Records a move that caused a cutoff.
+     *
+     * @param move The cell of the move
+     * @param ply The distance from the root
+     * @param player The player who made the move
+     * @param depth The number of plies that were left to search below it
+     */
+    constexpr void RecordCutoff(cell move, uint8_t ply, Utility::PlayerSymbol player, uint8_t depth) noexcept;
+
+    /**
+     * Scores a move; the higher, the sooner it is searched.
+     *
+     * @param move The cell of the move
+     * @param ply The distance from the root
+     * @param player The player making the move
+     * @param tactic Whether the move ends the game
+     * @param priority The static priority of the cell
+     * @return The score
+     */
+    [[nodiscard]] constexpr auto Score(cell move, uint8_t ply, Utility::PlayerSymbol player, Tactic tactic,
+                                       uint8_t priority) const noexcept -> score;
+};
+
+/**
+ * Hands out moves from the highest to the lowest score. The next move is
+ * only selected when asked for, so a cutoff after the first few moves skips
+ * sorting the rest.
+ *
+ * @tparam CAPACITY The maximum number of moves
+ */
+template <uint16_t CAPACITY>
+class MovePicker final
+{
+ public:
+
+    using cell = uint16_t;
+    using score = int32_t;
+
+ private:
+
+    std::array<cell, CAPACITY> moves {};
+    std::array<score, CAPACITY> scores {};
+    uint16_t size {0};
+    uint16_t next {0};
+    bool ordered {false};
+
+ public:
+
+    /**
+     * Adds a move.
+     *
+     * @param move The cell of the move
+     * @param move_score The score of the move
+     */
+    constexpr void Add(cell move, score move_score) noexcept;
+
+    /**
+     * Gets the move with the highest score among the ones not handed out yet.
+     * Equal scores keep the order in which the moves were added.
+     *
+     * @param move The cell of the move
+     * @return False if every move was handed out
+     */
+    constexpr auto Next(cell & move) noexcept -> bool;
+};
+
+template <uint16_t CELLS, uint8_t PLIES>
+constexpr auto MoveOrderer<CELLS, PLIES>::Get_Player_Index(Utility::PlayerSymbol player) noexcept -> size_t
+{
+    return (player == Utility::PlayerSymbol::X) ? 0 : 1;
+}
+
+template <uint16_t CELLS, uint8_t PLIES>
+constexpr MoveOrderer<CELLS, PLIES>::MoveOrderer(MoveOrdering ordering) noexcept : ordering(ordering)
+{
+    Clear();
+}
+
+template <uint16_t CELLS, uint8_t PLIES>
+constexpr void MoveOrderer<CELLS, PLIES>::SetOrdering(MoveOrdering new_ordering) noexcept
+{
+    ordering = new_ordering;
+}
+
+template <uint16_t CELLS, uint8_t PLIES>
+constexpr auto MoveOrderer<CELLS, PLIES>::GetOrdering() const noexcept -> MoveOrdering
+{
+    return ordering;
+}
+
+template <uint16_t CELLS, uint8_t PLIES>
+constexpr void MoveOrderer<CELLS, PLIES>::Clear() noexcept
+{
+    killers.fill({NO_MOVE, NO_MOVE});
+    history = {};
+}
+
+template <uint16_t CELLS, uint8_t PLIES>
+constexpr void MoveOrderer<CELLS, PLIES>::RecordCutoff(cell move, uint8_t ply, Utility::PlayerSymbol player,
+                                                       uint8_t depth) noexcept
+{
+    if (ordering >= MoveOrdering::KILLERS && killers[ply][0] != move)
+    {
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = move;
+    }
+    if (ordering >= MoveOrdering::HISTORY)
+    {
+        auto & counter = history[Get_Player_Index(player)][move];
+        counter = std::min(counter + uint32_t {depth} * depth + 1, HISTORY_MAX);
+    }
+}
+
+template <uint16_t CELLS, uint8_t PLIES>
+constexpr auto MoveOrderer<CELLS, PLIES>::Score(cell move, uint8_t ply, Utility::PlayerSymbol player, Tactic tactic,
+                                                uint8_t priority) const noexcept -> score
+{
+    if (ordering == MoveOrdering::NONE)
+    {
+        return 0;
+    }
+
+    score move_score = priority;
+
+    if (tactic == Tactic::WIN)
+    {
+        move_score += WIN_BONUS;
+    }
+    else if (tactic == Tactic::BLOCK)
+    {
+        move_score += BLOCK_BONUS;
+    }
+
+    if (ordering >= MoveOrdering::KILLERS)
+    {
+        #pragma GCC unroll 2
+        for (size_t slot = 0; slot < KILLER_BONUSES.size(); ++slot)
+        {
+            if (killers[ply][slot] == move)
+            {
+                move_score += KILLER_BONUSES[slot];
+            }
+        }
+    }
+    if (ordering >= MoveOrdering::HISTORY)
+    {
+        move_score += static_cast<score>(history[Get_Player_Index(player)][move] << HISTORY_SHIFT);
+    }
+    return move_score;
+}
+
+template <uint16_t CAPACITY>
+constexpr void MovePicker<CAPACITY>::Add(cell move, score move_score) noexcept
+{
+    moves[size] = move;
+    scores[size] = move_score;
+    ++size;
+
+    ordered = ordered || (move_score != 0);
+}
+
+template <uint16_t CAPACITY>
+constexpr auto MovePicker<CAPACITY>::Next(cell & move) noexcept -> bool
+{
+    if (next == size)
+    {
+        return false;
+    }
+    if (!ordered)
+    {
+        move = moves[next++];
+        return true;
+    }
+
+    auto best = next;
+    for (auto index = static_cast<uint16_t>(next + 1); index < size; ++index)
+    {
+        if (scores[index] > scores[best])
+        {
+            best = index;
+        }
+    }
+
+    // Shift instead of swapping, so that equal scores keep their order
+    move = moves[best];
+    auto const BEST_SCORE = scores[best];
+    std::copy_backward(moves.begin() + next, moves.begin() + best, moves.begin() + best + 1);
+    std::copy_backward(scores.begin() + next, scores.begin() + best, scores.begin() + best + 1);
+    moves[next] = move;
+    scores[next] = BEST_SCORE;
+    ++next;
+
+    return true;
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * @file OpeningBook.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the OpeningBook class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "BoardManager.hpp"
+#include "PerfectPlay.hpp"
+#include "BitBoard.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <array>
+
+/**
+ * Best moves of the first plies of the game, when the search has the most
+ * work to do and always finds the same answer. The book is copied from the
+ * perfect-play table at compile time and only keeps the canonical opening
+ * positions, so it is a handful of entries in flash and answering a position
+ * is a short linear scan.
+ */
+class OpeningBook final
+{
+ public:
+
+    /**
+     * Number of plies covered by the book: the positions with fewer pieces
+     * are found in it.
+     */
+    static constexpr uint8_t PLIES = 3;
+
+    /**
+     * Number of opening positions, up to rotations and reflections.
+     */
+    static constexpr size_t POSITIONS = 16;
+
+ private:
+
+    struct Book
+    {
+        std::array<BitBoard::key, POSITIONS> keys {};
+        std::array<BitBoard::mask, POSITIONS> best_moves {};
+        size_t size {0};
+    };
+
+    /**
+     * Adds a position and all the positions reachable from it within the
+     * book plies, as their canonical representatives.
+     *
+     * @param book The book built so far
+     * @param board The position
+     */
+    static constexpr void Collect(Book & book, BitBoard & board) noexcept;
+
+    /**
+     * Builds the book from the perfect-play table.
+     *
+     * @return The book
+     */
+    static constexpr auto Make_Book() noexcept -> Book;
+
+    static const Book BOOK;
+
+ public:
+
+    /**
+     * Gets all the moves that keep the minimax value of an opening position.
+     *
+     * @param board The position
+     * @return The cells of the best moves, or 0 if the position is not in the book
+     */
+    [[nodiscard]] static constexpr auto GetBestMoves(BitBoard const & board) noexcept -> BitBoard::mask;
+
+    /**
+     * Gets the number of positions stored in the book.
+     *
+     * @return The number of positions
+     */
+    [[nodiscard]] static constexpr auto GetSize() noexcept -> size_t;
+};
+
+constexpr void OpeningBook::Collect(Book & book, BitBoard & board) noexcept
+{
+    if (board.GetMoveCount() >= PLIES)
+    {
+        return;
+    }
+
+    auto const CANONICAL_BOARD = BoardManager::Canonicalise(board).first;
+    auto const KEY = CANONICAL_BOARD.GetKey();
+    if (std::find(book.keys.begin(), book.keys.begin() + book.size, KEY) == book.keys.begin() + book.size)
+    {
+        book.keys[book.size] = KEY;
+        book.best_moves[book.size] = PerfectPlay::GetBestMoves(CANONICAL_BOARD);
+        ++book.size;
+    }
+
+    auto const PLAYER = board.GetCurrentPlayer();
+    for (BitBoard::mask actions = board.GetEmpty(); actions != 0; actions &= actions - 1)
+    {
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+
+        board.MakeMove(CELL, PLAYER);
+        Collect(book, board);
+        board.UnmakeMove(CELL);
+    }
+}
+
+constexpr auto OpeningBook::Make_Book() noexcept -> Book
+{
+    Book book {};
+    BitBoard board {};
+
+    Collect(book, board);
+    return book;
+}
+
+inline constexpr OpeningBook::Book OpeningBook::BOOK = Make_Book();
+
+constexpr auto OpeningBook::GetBestMoves(BitBoard const & board) noexcept -> BitBoard::mask
+{
+    if (board.GetMoveCount() >= PLIES)
+    {
+        return 0;
+    }
+
+    auto const [CANONICAL_BOARD, SYMMETRY] = BoardManager::Canonicalise(board);
+    auto const KEY = CANONICAL_BOARD.GetKey();
+
+    for (size_t index = 0; index < BOOK.size; ++index)
+    {
+        if (BOOK.keys[index] == KEY)
+        {
+            return BoardManager::TransformMask(BOOK.best_moves[index], BoardManager::GetInverseSymmetry(SYMMETRY));
+        }
+    }
+    return 0;
+}
+
+constexpr auto OpeningBook::GetSize() noexcept -> size_t
+{
+    return BOOK.size;
+}
+
+// The book must hold every opening and agree with the table it was copied from
+static_assert(OpeningBook::GetSize() == OpeningBook::POSITIONS, "There are 16 openings up to symmetry");
+static_assert(OpeningBook::GetBestMoves(BitBoard {}) == BitBoard::FULL_MASK, "Every first move must keep the tie");
+static_assert(OpeningBook::GetBestMoves(BitBoard {0b000'000'001, 0}) == 0b000'010'000,
+              "The only reply to a corner must be the centre");
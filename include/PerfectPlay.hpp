@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * @file PerfectPlay.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the PerfectPlay class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "BoardManager.hpp"
+#include "BitBoard.hpp"
+#include "Utility.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <array>
+
+/**
+ * Table with the minimax value and the best moves of every position, built at
+ * compile time by solving the whole game tree from the empty board. Only the
+ * canonical representative of every group of symmetric positions is stored,
+ * sorted by key. Since it is a constant, the table is placed in flash and
+ * answering a position is a binary search.
+ */
+class PerfectPlay final
+{
+ public:
+
+    /**
+     * Number of reachable positions, up to rotations and reflections.
+     */
+    static constexpr size_t POSITIONS = 765;
+
+ private:
+
+    using entry = uint16_t;
+
+    static constexpr uint8_t VALUE_SHIFT = BitBoard::CELLS;
+    static constexpr entry VALUE_MASK = 0b11;
+    static constexpr entry SOLVED = 1U << 15U;
+
+    using solutions = std::array<entry, BitBoard::KEY_COUNT>;
+
+    struct Table
+    {
+        std::array<BitBoard::key, POSITIONS> keys {};
+        std::array<entry, POSITIONS> entries {};
+        size_t size {0};
+    };
+
+    /**
+     * Solves a position and all the positions reachable from it, storing the
+     * results of their canonical representatives. Already solved positions
+     * are not searched again.
+     *
+     * @param solved The solutions found so far, indexed by key
+     * @param board The position to be solved
+     * @return The minimax value of the position
+     */
+    static constexpr auto Solve(solutions & solved, BitBoard const & board) noexcept -> Utility::Value;
+
+    /**
+     * Builds the table by solving the game from the empty board and keeping
+     * only the solved canonical positions.
+     *
+     * @return The table
+     */
+    static constexpr auto Make_Table() noexcept -> Table;
+
+    /**
+     * Finds the entry of a canonical position.
+     *
+     * @param canonical_board The canonical position
+     * @return The entry, or 0 if the position is not reachable
+     */
+    static constexpr auto Find(BitBoard const & canonical_board) noexcept -> entry;
+
+    static const Table TABLE;
+
+ public:
+
+    /**
+     * Checks if the position can be reached in a game, i.e. if it is found in
+     * the table.
+     *
+     * @param board The position
+     * @return True or False
+     */
+    [[nodiscard]] static constexpr auto IsReachable(BitBoard const & board) noexcept -> bool;
+
+    /**
+     * Gets the minimax value of a reachable position.
+     *
+     * @param board The position
+     * @return The value of the position (1 if X wins, -1 if O wins, 0 for a tie)
+     */
+    [[nodiscard]] static constexpr auto GetValue(BitBoard const & board) noexcept -> Utility::Value;
+
+    /**
+     * Gets all the moves that keep the minimax value of a reachable position.
+     *
+     * @param board The position
+     * @return The cells of the best moves (empty for a terminal position)
+     */
+    [[nodiscard]] static constexpr auto GetBestMoves(BitBoard const & board) noexcept -> BitBoard::mask;
+
+    /**
+     * Gets the number of positions stored in the table.
+     *
+     * @return The number of positions
+     */
+    [[nodiscard]] static constexpr auto GetSize() noexcept -> size_t;
+};
+
+constexpr auto PerfectPlay::Solve(solutions & solved, BitBoard const & board) noexcept -> Utility::Value
+{
+    auto canonical_board = BoardManager::Canonicalise(board).first;
+    auto const KEY = canonical_board.GetKey();
+
+    if (solved[KEY] & SOLVED)
+    {
+        return static_cast<Utility::Value>(((solved[KEY] >> VALUE_SHIFT) & VALUE_MASK) - 1);
+    }
+
+    Utility::Value value = canonical_board.GetValue();
+    BitBoard::mask best_moves = 0;
+
+    if (!canonical_board.IsTerminal())
+    {
+        auto const PLAYER = canonical_board.GetCurrentPlayer();
+        auto const SIGN = static_cast<Utility::Value>((PLAYER == Utility::PlayerSymbol::X) ? 1 : -1);
+
+        value = -2;
+        for (BitBoard::mask actions = canonical_board.GetEmpty(); actions != 0; actions &= actions - 1)
+        {
+            auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+
+            canonical_board.MakeMove(CELL, PLAYER);
+            auto const CHILD_VALUE = static_cast<Utility::Value>(SIGN * Solve(solved, canonical_board));
+            canonical_board.UnmakeMove(CELL);
+
+            if (CHILD_VALUE > value)
+            {
+                value = CHILD_VALUE;
+                best_moves = 0;
+            }
+            if (CHILD_VALUE == value)
+            {
+                best_moves |= static_cast<BitBoard::mask>(1U << CELL);
+            }
+        }
+        value = static_cast<Utility::Value>(SIGN * value);
+    }
+
+    solved[KEY] = static_cast<entry>(SOLVED | ((value + 1) << VALUE_SHIFT) | best_moves);
+    return value;
+}
+
+constexpr auto PerfectPlay::Make_Table() noexcept -> Table
+{
+    solutions solved {};
+    Table table {};
+
+    Solve(solved, BitBoard {});
+    for (size_t key = 0; key < BitBoard::KEY_COUNT; ++key)
+    {
+        if (solved[key] & SOLVED)
+        {
+            table.keys[table.size] = static_cast<BitBoard::key>(key);
+            table.entries[table.size] = solved[key];
+            ++table.size;
+        }
+    }
+    return table;
+}
+
+inline constexpr PerfectPlay::Table PerfectPlay::TABLE = Make_Table();
+
+constexpr auto PerfectPlay::Find(BitBoard const & canonical_board) noexcept -> entry
+{
+    auto const KEY = canonical_board.GetKey();
+    auto const POSITION = std::lower_bound(TABLE.keys.begin(), TABLE.keys.end(), KEY);
+
+    if (POSITION == TABLE.keys.end() || *POSITION != KEY)
+    {
+        return 0;
+    }
+    return TABLE.entries[static_cast<size_t>(POSITION - TABLE.keys.begin())];
+}
+
+constexpr auto PerfectPlay::IsReachable(BitBoard const & board) noexcept -> bool
+{
+    return Find(BoardManager::Canonicalise(board).first) & SOLVED;
+}
+
+constexpr auto PerfectPlay::GetValue(BitBoard const & board) noexcept -> Utility::Value
+{
+    auto const ENTRY = Find(BoardManager::Canonicalise(board).first);
+
+    return static_cast<Utility::Value>(((ENTRY >> VALUE_SHIFT) & VALUE_MASK) - 1);
+}
+
+constexpr auto PerfectPlay::GetBestMoves(BitBoard const & board) noexcept -> BitBoard::mask
+{
+    auto const [CANONICAL_BOARD, SYMMETRY] = BoardManager::Canonicalise(board);
+    auto const CANONICAL_MOVES = static_cast<BitBoard::mask>(Find(CANONICAL_BOARD) & BitBoard::FULL_MASK);
+
+    return BoardManager::TransformMask(CANONICAL_MOVES, BoardManager::GetInverseSymmetry(SYMMETRY));
+}
+
+constexpr auto PerfectPlay::GetSize() noexcept -> size_t
+{
+    return TABLE.size;
+}
+
+// Sanity checks of the generated table against well known results
+static_assert(PerfectPlay::GetSize() == PerfectPlay::POSITIONS, "There are 765 positions up to symmetry");
+static_assert(PerfectPlay::GetValue(BitBoard {}) == 0, "The empty board must be a tie");
+static_assert(PerfectPlay::GetBestMoves(BitBoard {}) == BitBoard::FULL_MASK, "Every first move must keep the tie");
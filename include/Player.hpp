@@ -60,5 +60,12 @@ class Player
      * @return A move
      */
     [[nodiscard]] auto GetNextMove(Utility::Board const & current_board) noexcept -> Move;
+
+    /**
+     * Gets the player's strategy, e.g. to run it on the other core.
+     *
+     * @return The strategy
+     */
+    [[nodiscard]] auto GetStrategy() noexcept -> IPlayerStrategy &;
 };
 
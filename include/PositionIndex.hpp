@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * @file PositionIndex.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the PositionIndex class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "BitBoard.hpp"
+
+#include <cstdint>
+#include <array>
+#include <bit>
+
+/**
+ * Minimal perfect hash of the legal positions: every position reachable from
+ * the empty board (stopping at wins) gets a dense index lower than POSITIONS,
+ * in increasing order of its base-3 key, so tables indexed by position need
+ * 5478 entries instead of 19683 and fit a 16-bit key. Ranking reads one word
+ * of a bitset of the legal keys and adds its population count to a per-word
+ * prefix, so it has no branch; unranking reads the sorted keys back. All the
+ * tables are built at compile time and live in flash.
+ */
+class PositionIndex final
+{
+ public:
+
+    using index = uint16_t;
+
+    /**
+     * Number of legal positions, i.e. distinct indices.
+     */
+    static constexpr index POSITIONS = 5'478;
+
+ private:
+
+    using word = uint32_t;
+
+    static constexpr uint8_t WORD_BITS = 32;
+    static constexpr size_t WORDS = (BitBoard::KEY_COUNT + WORD_BITS - 1) / WORD_BITS;
+
+    struct Table
+    {
+        std::array<word, WORDS> legal {};              /* One bit per legal key */
+        std::array<index, WORDS> ranks {};             /* Legal keys before each word */
+        std::array<BitBoard::key, POSITIONS> keys {};  /* Legal keys in increasing order */
+        size_t size {0};
+    };
+
+    /**
+     * Marks a position and all the positions reachable from it as legal.
+     *
+     * @param table The table built so far
+     * @param board The position
+     */
+    static constexpr void Collect(Table & table, BitBoard & board) noexcept;
+
+    /**
+     * Builds the rank and unrank tables of the legal positions.
+     *
+     * @return The tables
+     */
+    static constexpr auto Make_Table() noexcept -> Table;
+
+    static const Table TABLE;
+
+ public:
+
+    /**
+     * Checks if a position can be reached in a game.
+     *
+     * @param board The position
+     * @return True or False
+     */
+    [[nodiscard]] static constexpr auto IsLegal(BitBoard const & board) noexcept -> bool;
+
+    /**
+     * Computes the dense index of a legal position. The result is unspecified
+     * for positions that are not legal.
+     *
+     * @param board The position
+     * @return The index, lower than POSITIONS
+     */
+    [[nodiscard]] static constexpr auto GetIndex(BitBoard const & board) noexcept -> index;
+
+    /**
+     * Rebuilds the position that has a given index.
+     *
+     * @param position_index The index, lower than POSITIONS
+     * @return The position
+     */
+    [[nodiscard]] static constexpr auto GetPosition(index position_index) noexcept -> BitBoard;
+
+    /**
+     * Gets the number of legal positions found when building the tables.
+     *
+     * @return The number of positions
+     */
+    [[nodiscard]] static constexpr auto GetSize() noexcept -> size_t;
+};
+
+constexpr void PositionIndex::Collect(Table & table, BitBoard & board) noexcept
+{
+    auto const KEY = board.GetKey();
+    auto const BIT = word {1} << (KEY % WORD_BITS);
+    if (table.legal[KEY / WORD_BITS] & BIT)
+    {
+        return;
+    }
+    table.legal[KEY / WORD_BITS] |= BIT;
+    ++table.size;
+
+    if (board.IsTerminal())
+    {
+        return;
+    }
+
+    auto const PLAYER = board.GetCurrentPlayer();
+    for (BitBoard::mask actions = board.GetEmpty(); actions != 0; actions &= actions - 1)
+    {
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+
+        board.MakeMove(CELL, PLAYER);
+        Collect(table, board);
+        board.UnmakeMove(CELL);
+    }
+}
+
+constexpr auto PositionIndex::Make_Table() noexcept -> Table
+{
+    Table table {};
+    BitBoard board {};
+
+    Collect(table, board);
+
+    index rank = 0;
+    for (size_t position = 0; position < WORDS; ++position)
+    {
+        table.ranks[position] = rank;
+        for (word bits = table.legal[position]; bits != 0 && rank < POSITIONS; bits &= bits - 1)
+        {
+            table.keys[rank] = static_cast<BitBoard::key>(position * WORD_BITS + static_cast<size_t>(std::countr_zero(bits)));
+            ++rank;
+        }
+    }
+    return table;
+}
+
+inline constexpr PositionIndex::Table PositionIndex::TABLE = Make_Table();
+
+constexpr auto PositionIndex::IsLegal(BitBoard const & board) noexcept -> bool
+{
+    auto const KEY = board.GetKey();
+    return (TABLE.legal[KEY / WORD_BITS] >> (KEY % WORD_BITS)) & 1U;
+}
+
+constexpr auto PositionIndex::GetIndex(BitBoard const & board) noexcept -> index
+{
+    auto const KEY = board.GetKey();
+    auto const BELOW = (word {1} << (KEY % WORD_BITS)) - 1;
+    return static_cast<index>(TABLE.ranks[KEY / WORD_BITS] + std::popcount(TABLE.legal[KEY / WORD_BITS] & BELOW));
+}
+
+constexpr auto PositionIndex::GetPosition(index position_index) noexcept -> BitBoard
+{
+    return BitBoard::FromKey(TABLE.keys[position_index]);
+}
+
+constexpr auto PositionIndex::GetSize() noexcept -> size_t
+{
+    return TABLE.size;
+}
+
+// The index must be a bijection between the legal positions and [0, POSITIONS)
+static_assert(PositionIndex::GetSize() == PositionIndex::POSITIONS, "There are 5478 legal positions");
+static_assert(PositionIndex::GetIndex(BitBoard {}) == 0, "The empty board has the lowest key");
+static_assert(!PositionIndex::IsLegal(BitBoard {0b000'000'011, 0}), "X cannot be two pieces ahead");
+static_assert([]
+{
+    for (PositionIndex::index position = 0; position < PositionIndex::POSITIONS; ++position)
+    {
+        auto const BOARD = PositionIndex::GetPosition(position);
+        if (!PositionIndex::IsLegal(BOARD) || PositionIndex::GetIndex(BOARD) != position)
+        {
+            return false;
+        }
+    }
+    return true;
+}(), "Unranking and ranking must give back the same index");
@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * @file PrincipalVariation.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the PrincipalVariation class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <array>
+
+/**
+ * The line of best play found by a search: the best move, the best reply to
+ * it and so on. Every node of the search keeps the line below it, so the
+ * lines are built from the leaves up without allocating. A line can end
+ * before the game does, e.g. on a transposition table hit.
+ *
+ * @tparam CAPACITY The maximum number of moves
+ */
+template <uint8_t CAPACITY>
+class PrincipalVariation final
+{
+ public:
+
+    using cell = uint16_t;
+
+ private:
+
+    std::array<cell, CAPACITY> moves {};
+    uint8_t length {0};
+
+ public:
+
+    /**
+     * Removes all the moves.
+     */
+    constexpr void Clear() noexcept;
+
+    /**
+     * Replaces the line with a move followed by the line below it.
+     *
+     * @param move The first move
+     * @param rest The line after the move
+     */
+    constexpr void Set(cell move, PrincipalVariation const & rest) noexcept;
+
+    /**
+     * Appends a move at the end of the line.
+     *
+     * @param move The move
+     */
+    constexpr void Add(cell move) noexcept;
+
+    /**
+     * Gets the number of moves in the line.
+     *
+     * @return The length
+     */
+    [[nodiscard]] constexpr auto GetLength() const noexcept -> uint8_t;
+
+    /**
+     * [Subscript operator] Gets a move of the line.
+     *
+     * @param index The position in the line, 0 being the best move
+     * @return The cell of the move
+     */
+    [[nodiscard]] constexpr auto operator[](uint8_t index) const noexcept -> cell;
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> cell const *;
+
+    [[nodiscard]] constexpr auto end() const noexcept -> cell const *;
+};
+
+template <uint8_t CAPACITY>
+constexpr void PrincipalVariation<CAPACITY>::Clear() noexcept
+{
+    length = 0;
+}
+
+template <uint8_t CAPACITY>
+constexpr void PrincipalVariation<CAPACITY>::Set(cell move, PrincipalVariation const & rest) noexcept
+{
+    moves[0] = move;
+    length = static_cast<uint8_t>(std::min<int>(rest.length + 1, CAPACITY));
+    std::copy_n(rest.moves.begin(), length - 1, moves.begin() + 1);
+}
+
+template <uint8_t CAPACITY>
+constexpr void PrincipalVariation<CAPACITY>::Add(cell move) noexcept
+{
+    if (length < CAPACITY)
+    {
+        moves[length++] = move;
+    }
+}
+
+template <uint8_t CAPACITY>
+constexpr auto PrincipalVariation<CAPACITY>::GetLength() const noexcept -> uint8_t
+{
+    return length;
+}
+
+template <uint8_t CAPACITY>
+constexpr auto PrincipalVariation<CAPACITY>::operator[](uint8_t index) const noexcept -> cell
+{
+    return moves[index];
+}
+
+template <uint8_t CAPACITY>
+constexpr auto PrincipalVariation<CAPACITY>::begin() const noexcept -> cell const *
+{
+    return moves.data();
+}
+
+template <uint8_t CAPACITY>
+constexpr auto PrincipalVariation<CAPACITY>::end() const noexcept -> cell const *
+{
+    return moves.data() + length;
+}
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * @file Profiler.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the Profiler class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <pico/sync.h>
+#include <pico/time.h>
+
+#include "LCD_I2C.hpp"
+
+#include <string_view>
+#include <cstdint>
+#include <array>
+
+#ifndef TIC_TAC_TOE_PROFILING
+#define TIC_TAC_TOE_PROFILING 0
+#endif
+
+#if TIC_TAC_TOE_PROFILING
+/**
+ * Times the rest of the enclosing scope and records it for a profiling site.
+ */
+#define PROFILE_SCOPE(site) Profiler::ScopedTimer const PROFILE_TIMER {Profiler::Site::site}
+#else
+#define PROFILE_SCOPE(site) static_cast<void>(0)
+#endif
+
+/**
+ * Collects the duration of the user-visible operations, measured with the
+ * 64-bit microsecond timer, so it is valid on both cores and never wraps. The
+ * last samples are kept in a fixed-size ring buffer and every site keeps its
+ * minimum, maximum and mean, so recording never allocates. The sites are only
+ * instrumented when the TIC_TAC_TOE_PROFILING build option is on.
+ */
+class Profiler final
+{
+ public:
+
+    /**
+     * Instrumented operations.
+     */
+    enum class Site : uint8_t
+    {
+        AI_MOVE,         /* HardStrategy and MctsStrategy::GetNextMove, mixed */
+        LCD_PRINT,       /* LCD_I2C::Flush */
+        SCOREBOARD_SEND, /* TM1637::Send_4_Bytes */
+        COUNT
+    };
+
+    /**
+     * Aggregated durations of a site, in microseconds.
+     */
+    struct Statistics
+    {
+        uint32_t count {0};
+        uint32_t min {UINT32_MAX};
+        uint32_t max {0};
+        uint64_t total {0};
+
+        /**
+         * Computes the mean duration.
+         *
+         * @return The mean, or 0 if there are no samples
+         */
+        [[nodiscard]] constexpr auto GetMean() const noexcept -> uint32_t;
+    };
+
+    /**
+     * One recorded duration.
+     */
+    struct Sample
+    {
+        Site site {Site::COUNT};
+        uint32_t duration {0};
+    };
+
+    /**
+     * Number of samples kept in the ring buffer.
+     */
+    static constexpr uint8_t HISTORY_SIZE = 32;
+
+    /**
+     * Records the time spent between its construction and its destruction.
+     */
+    class ScopedTimer final
+    {
+     private:
+
+        Site site;
+        uint64_t start;
+
+     public:
+
+        /**
+         * [Constructor] Starts the timer.
+         *
+         * @param site The profiled site
+         */
+        explicit ScopedTimer(Site site) noexcept;
+
+        /**
+         * [Destructor] Stops the timer and records the duration.
+         */
+        ~ScopedTimer() noexcept;
+
+        ScopedTimer(ScopedTimer const &) = delete;
+        ScopedTimer(ScopedTimer &&) = delete;
+        auto operator=(ScopedTimer const &) -> ScopedTimer & = delete;
+        auto operator=(ScopedTimer &&) -> ScopedTimer & = delete;
+    };
+
+ private:
+
+    static constexpr auto SITES = static_cast<size_t>(Site::COUNT);
+
+    static critical_section_t lock;
+
+    static LCD_I2C * display;
+
+    static std::array<Statistics, SITES> statistics;
+    static std::array<Sample, HISTORY_SIZE> history;
+    static uint8_t next_sample;
+
+    /**
+     * Formats a duration in 5 characters, switching to milliseconds for long
+     * durations.
+     *
+     * @param duration The duration in microseconds
+     * @return The text
+     */
+    [[nodiscard]] static auto Format_Duration(uint32_t duration) noexcept -> std::array<char, 6>;
+
+ public:
+
+    /**
+     * Initialises the lock shared by both cores. It must be called before
+     * anything is recorded.
+     */
+    static void Init() noexcept;
+
+    /**
+     * Sets the LCD screen used to show the results.
+     *
+     * @param lcd The LCD screen
+     */
+    static void SetDisplay(LCD_I2C * lcd) noexcept;
+
+    /**
+     * Records a duration.
+     *
+     * @param site The profiled site
+     * @param duration The duration in microseconds
+     */
+    static void Record(Site site, uint32_t duration) noexcept;
+
+    /**
+     * Gets the aggregated durations of a site.
+     *
+     * @param site The profiled site
+     * @return The statistics
+     */
+    [[nodiscard]] static auto GetStatistics(Site site) noexcept -> Statistics;
+
+    /**
+     * Gets the last recorded samples, from the oldest to the newest. Unused
+     * slots have the site set to COUNT.
+     *
+     * @return The samples
+     */
+    [[nodiscard]] static auto GetHistory() noexcept -> std::array<Sample, HISTORY_SIZE>;
+
+    /**
+     * Removes all the recorded durations.
+     */
+    static void Reset() noexcept;
+
+    /**
+     * Gets a short name of a site that fits the LCD screen.
+     *
+     * @param site The profiled site
+     * @return The name
+     */
+    [[gnu::const]][[nodiscard]] static auto GetSiteName(Site site) noexcept -> std::string_view;
+
+    /**
+     * Shows the minimum, mean and maximum duration of every site on top of
+     * the screen of the game, if an LCD screen was set.
+     */
+    static void Dump() noexcept;
+
+    /**
+     * Checks if the durations are shown.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] static auto IsDumpShown() noexcept -> bool;
+
+    /**
+     * Hides the durations and shows the screen of the game again.
+     */
+    static void HideDump() noexcept;
+};
+
+constexpr auto Profiler::Statistics::GetMean() const noexcept -> uint32_t
+{
+    return (count == 0) ? 0 : static_cast<uint32_t>(total / count);
+}
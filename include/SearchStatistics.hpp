@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * @file SearchStatistics.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the BasicSearchStatistics structure.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "BitBoard.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <array>
+
+#ifndef TIC_TAC_TOE_SEARCH_STATISTICS
+#define TIC_TAC_TOE_SEARCH_STATISTICS 0
+#endif
+
+/**
+ * Effort spent by one search. It is only collected when the
+ * TIC_TAC_TOE_SEARCH_STATISTICS build option is on; otherwise every counter
+ * stays 0 and the code that updates them is compiled out.
+ *
+ * @tparam PLIES The number of plies that can be searched below the root
+ */
+template <uint8_t PLIES>
+struct BasicSearchStatistics
+{
+    /**
+     * Whether the statistics are collected.
+     */
+    static constexpr bool ENABLED = TIC_TAC_TOE_SEARCH_STATISTICS != 0;
+
+    /**
+     * Number of plies that can be searched below the root.
+     */
+    static constexpr uint8_t MAX_PLY = PLIES;
+
+    uint32_t nodes {0};                             /* Positions visited, including the leaves */
+    uint32_t leaves {0};                            /* Terminal positions evaluated */
+    std::array<uint32_t, MAX_PLY> alpha_cutoffs {}; /* Cutoffs in the minimising nodes (O to move), per ply */
+    std::array<uint32_t, MAX_PLY> beta_cutoffs {};  /* Cutoffs in the maximising nodes (X to move), per ply */
+    uint32_t researches {0};                        /* Null-window searches that had to be repeated */
+    uint8_t max_depth {0};                          /* Deepest ply reached */
+    uint32_t elapsed {0};                           /* Duration of the search in microseconds */
+    uint32_t tt_hits {0};                           /* Usable transposition table lookups */
+    uint32_t tt_misses {0};                         /* Unusable transposition table lookups */
+
+    /**
+     * Computes the number of alpha cutoffs over all plies.
+     *
+     * @return The number of cutoffs
+     */
+    [[nodiscard]] constexpr auto GetAlphaCutoffs() const noexcept -> uint32_t;
+
+    /**
+     * Computes the number of beta cutoffs over all plies.
+     *
+     * @return The number of cutoffs
+     */
+    [[nodiscard]] constexpr auto GetBetaCutoffs() const noexcept -> uint32_t;
+
+    /**
+     * Adds the effort of another search of the same position, e.g. the part
+     * of a parallel search done by another thread. The duration is kept.
+     *
+     * @param other The other statistics
+     */
+    constexpr void Add(BasicSearchStatistics const & other) noexcept;
+};
+
+template <uint8_t PLIES>
+constexpr auto BasicSearchStatistics<PLIES>::GetAlphaCutoffs() const noexcept -> uint32_t
+{
+    uint32_t total = 0;
+    for (auto const CUTOFFS: alpha_cutoffs)
+    {
+        total += CUTOFFS;
+    }
+    return total;
+}
+
+template <uint8_t PLIES>
+constexpr auto BasicSearchStatistics<PLIES>::GetBetaCutoffs() const noexcept -> uint32_t
+{
+    uint32_t total = 0;
+    for (auto const CUTOFFS: beta_cutoffs)
+    {
+        total += CUTOFFS;
+    }
+    return total;
+}
+
+template <uint8_t PLIES>
+constexpr void BasicSearchStatistics<PLIES>::Add(BasicSearchStatistics const & other) noexcept
+{
+    nodes += other.nodes;
+    leaves += other.leaves;
+    for (uint8_t ply = 0; ply < MAX_PLY; ++ply)
+    {
+        alpha_cutoffs[ply] += other.alpha_cutoffs[ply];
+        beta_cutoffs[ply] += other.beta_cutoffs[ply];
+    }
+    researches += other.researches;
+    max_depth = std::max(max_depth, other.max_depth);
+    tt_hits += other.tt_hits;
+    tt_misses += other.tt_misses;
+}
+
+/**
+ * Effort spent by one search of the 3x3 board.
+ */
+using SearchStatistics = BasicSearchStatistics<BitBoard::CELLS + 1>;
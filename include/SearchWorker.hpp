@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * @file SearchWorker.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the SearchWorker class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include <pico/multicore.h>
+
+#include "IPlayerStrategy.hpp"
+#include "BitBoard.hpp"
+#include "Utility.hpp"
+#include "Move.hpp"
+
+#include <cstdint>
+#include <atomic>
+
+/**
+ * Computes the moves of the computer on the second core, so that the first
+ * one keeps serving the keypad and the displays while the computer thinks.
+ * The cores talk over the inter-core FIFOs with 32-bit messages, the type in
+ * the top byte and the payload below it:
+ *
+ *  - SEARCH (first core): the board, as the masks of X and O
+ *  - CANCEL (first core): play the best move found so far
+ *  - PROGRESS (second core): the number of root moves searched and their total
+ *  - MOVE (second core): the cell of the chosen move
+ *
+ * Every SEARCH gets exactly one MOVE, even when it is cancelled, and the
+ * first core sends nothing but a CANCEL until it gets it. A CANCEL that
+ * arrives after the MOVE was sent is dropped before the next SEARCH.
+ */
+class SearchWorker final : public ISearchMonitor
+{
+ public:
+
+    /**
+     * The type of a message.
+     */
+    enum class Message : uint8_t
+    {
+        NONE,
+        SEARCH,
+        CANCEL,
+        PROGRESS,
+        MOVE
+    };
+
+    /**
+     * A message received by the first core.
+     */
+    struct Reply
+    {
+        Message type {Message::NONE};
+        uint8_t done {0};  /* PROGRESS: the number of root moves searched */
+        uint8_t total {0}; /* PROGRESS: the number of root moves */
+        Move move {};      /* MOVE: the chosen move */
+    };
+
+ private:
+
+    static constexpr uint8_t TYPE_SHIFT = 24;
+    static constexpr uint32_t PAYLOAD_MASK = (uint32_t {1} << TYPE_SHIFT) - 1;
+
+    /**
+     * Position of the number of root moves searched in a PROGRESS payload,
+     * above their total.
+     */
+    static constexpr uint8_t DONE_SHIFT = 8;
+
+    /**
+     * The strategy used by the next search. It is set before the SEARCH
+     * message is sent, so the second core sees it when it gets the message.
+     */
+    static inline std::atomic<IPlayerStrategy *> strategy {nullptr};
+
+    bool cancelled {false};
+
+    /**
+     * Builds a message.
+     *
+     * @param type The type
+     * @param payload The payload, within 24 bits
+     * @return The message
+     */
+    [[gnu::const]][[nodiscard]] static constexpr auto Pack(Message type, uint32_t payload) noexcept -> uint32_t;
+
+    /**
+     * Gets the type of a message.
+     *
+     * @param message The message
+     * @return The type
+     */
+    [[gnu::const]][[nodiscard]] static constexpr auto Get_Type(uint32_t message) noexcept -> Message;
+
+    /**
+     * Gets the payload of a message.
+     *
+     * @param message The message
+     * @return The payload
+     */
+    [[gnu::const]][[nodiscard]] static constexpr auto Get_Payload(uint32_t message) noexcept -> uint32_t;
+
+    /**
+     * Serves the search requests. It runs on the second core.
+     */
+    [[noreturn]] static void Run() noexcept;
+
+ public:
+
+    /**
+     * Starts the worker on the second core.
+     */
+    static void Launch() noexcept;
+
+    /**
+     * Asks the second core for a move. The answer is read with GetReply.
+     *
+     * @param player_strategy The strategy that chooses the move
+     * @param current_board The board to be analysed
+     */
+    static void Start(IPlayerStrategy & player_strategy, Utility::Board const & current_board) noexcept;
+
+    /**
+     * Asks the second core to play the best move found so far. It must be
+     * sent at most once per search.
+     */
+    static void Cancel() noexcept;
+
+    /**
+     * Gets the next message from the second core without waiting.
+     *
+     * @return The message, or one of type NONE if there is none
+     */
+    [[nodiscard]] static auto GetReply() noexcept -> Reply;
+
+    /**
+     * Sends the progress of the search to the first core. It is dropped if
+     * the FIFO is full, so the search never waits for the display.
+     *
+     * @param done The number of root moves searched
+     * @param total The number of root moves
+     */
+    void ReportProgress(uint8_t done, uint8_t total) noexcept final;
+
+    /**
+     * Checks if the first core sent a CANCEL during the search.
+     *
+     * @return True or False
+     */
+    [[nodiscard]] auto IsCancelled() noexcept -> bool final;
+};
+
+constexpr auto SearchWorker::Pack(Message type, uint32_t payload) noexcept -> uint32_t
+{
+    return (static_cast<uint32_t>(type) << TYPE_SHIFT) | (payload & PAYLOAD_MASK);
+}
+
+constexpr auto SearchWorker::Get_Type(uint32_t message) noexcept -> Message
+{
+    return static_cast<Message>(message >> TYPE_SHIFT);
+}
+
+constexpr auto SearchWorker::Get_Payload(uint32_t message) noexcept -> uint32_t
+{
+    return message & PAYLOAD_MASK;
+}
+
+static_assert(2 * BitBoard::CELLS <= 24, "A board must fit in the payload of a message");
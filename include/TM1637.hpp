@@ -15,6 +15,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <utility>
+#include <array>
 
 class TM1637
 {
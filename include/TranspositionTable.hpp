@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * @file TranspositionTable.hpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Header file for the TranspositionTable class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#pragma once
+
+#include "BitBoard.hpp"
+#include "Utility.hpp"
+
+#include <optional>
+#include <cstdint>
+#include <array>
+
+#ifndef TIC_TAC_TOE_TT_SIZE
+#define TIC_TAC_TOE_TT_SIZE 4096
+#endif
+
+/**
+ * Fixed-size, direct-mapped cache of already searched positions. The table
+ * lives entirely inside the object, so it never allocates. Since the search is
+ * depth-unlimited, a stored value only depends on the position, never on the
+ * path used to reach it, and the entries stay valid between moves and games.
+ */
+class TranspositionTable final
+{
+ public:
+
+    /**
+     * Number of entries, configurable at build time.
+     */
+    static constexpr size_t SIZE = TIC_TAC_TOE_TT_SIZE;
+
+    /**
+     * Relation between a stored value and the real value of the position.
+     */
+    enum class Bound : uint8_t
+    {
+        EXACT,
+        LOWER,
+        UPPER
+    };
+
+ private:
+
+    static constexpr BitBoard::key EMPTY_KEY = BitBoard::KEY_COUNT;
+
+    struct Entry
+    {
+        BitBoard::key key {EMPTY_KEY};
+        Utility::Value value {};
+        Bound bound {};
+    };
+
+    static_assert(SIZE > 0, "The transposition table needs at least one entry");
+    static_assert(SIZE * sizeof(Entry) <= 64 * 1024, "The transposition table does not fit in SRAM");
+
+    std::array<Entry, SIZE> entries {};
+
+    uint32_t hits {0};
+    uint32_t misses {0};
+
+ public:
+
+    /**
+     * [Constructor]
+     */
+    TranspositionTable() noexcept = default;
+
+    /**
+     * Looks up a position and checks if the stored value can be used inside
+     * the current alpha–beta window.
+     *
+     * @param key The position key
+     * @param alpha The alpha parameter
+     * @param beta The beta parameter
+     * @return The stored value if it is usable, nothing otherwise
+     */
+    [[nodiscard]] auto Probe(BitBoard::key key, Utility::Value alpha,
+                             Utility::Value beta) noexcept -> std::optional<Utility::Value>;
+
+    /**
+     * Stores the result of a search, replacing any previous entry that maps
+     * to the same slot.
+     *
+     * @param key The position key
+     * @param value The searched value
+     * @param bound The relation between the value and the real one
+     */
+    void Store(BitBoard::key key, Utility::Value value, Bound bound) noexcept;
+
+    /**
+     * Classifies a searched value based on the window it was searched with.
+     *
+     * @param value The searched value
+     * @param alpha The initial alpha parameter
+     * @param beta The initial beta parameter
+     * @return The bound type
+     */
+    [[gnu::const]] static auto GetBound(Utility::Value value, Utility::Value alpha,
+                                        Utility::Value beta) noexcept -> Bound;
+
+    /**
+     * Removes all the stored entries.
+     */
+    void Clear() noexcept;
+
+    /**
+     * Gets the number of usable lookups since the last reset.
+     *
+     * @return The number of hits
+     */
+    [[gnu::pure]] [[nodiscard]] auto GetHits() const noexcept -> uint32_t;
+
+    /**
+     * Gets the number of unusable lookups since the last reset.
+     *
+     * @return The number of misses
+     */
+    [[gnu::pure]] [[nodiscard]] auto GetMisses() const noexcept -> uint32_t;
+
+    /**
+     * Resets the hit and miss counters.
+     */
+    void ResetCounters() noexcept;
+};
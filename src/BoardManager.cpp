@@ -94,26 +94,9 @@ auto BoardManager::GetCurrentPlayer(Board const & current_board) noexcept -> Pla
     return (moves % 2 == 0) ? PlayerSymbol::X : PlayerSymbol::O;
 }
 
-auto BoardManager::GetActions(Board const & current_board) noexcept -> std::vector<Move>
+auto BoardManager::GetActions(Board const & current_board) noexcept -> MoveList
 {
-    static std::vector<Move> actions;
-    actions.reserve(BOARD_SIZE * BOARD_SIZE);
-
-    actions.clear();
-
-    #pragma GCC unroll 3
-    for (size_t row = 0; row < BOARD_SIZE; ++row)
-    {
-        #pragma GCC unroll 3
-        for (size_t column = 0; column < BOARD_SIZE; ++column)
-        {
-            if (current_board[row][column] == PlayerSymbol::UNK)
-            {
-                actions.emplace_back(row, column);
-            }
-        }
-    }
-    return actions;
+    return MoveList {BitBoard {current_board}.GetEmpty()};
 }
 
 auto BoardManager::GetWinner(Board const & current_board) noexcept -> PlayerSymbol
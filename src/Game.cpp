@@ -33,15 +33,35 @@ Game::Game(LCD_I2C * lcd, TM1637 * led_segments, Keypad * keypad) noexcept
         lcd->CreateCustomChar(location, CUSTOM_SYMBOLS.at(location));
     }
 
+    Profiler::SetDisplay(lcd);
     Init_Second_Core();
 }
 
-void Game::Init_Second_Core() const noexcept
+void Game::Init_Second_Core() noexcept
 {
-    multicore_launch_core1(Key_Poller_Runner);
-    multicore_fifo_push_blocking(reinterpret_cast<uint32_t>(keypad.get()));
-    multicore_fifo_push_blocking(reinterpret_cast<uint32_t>(lcd.get()));
-    multicore_fifo_push_blocking(reinterpret_cast<uint32_t>(led_segments.get()));
+    key_handler_game = this;
+    Keypad::SetKeyHandler(Handle_Control_Key);
+
+    SearchWorker::Launch();
+}
+
+auto Game::Handle_Control_Key(Key key) noexcept -> bool
+{
+    auto * game = key_handler_game;
+
+    if (key == BACKLIGHT_KEY)
+    {
+        game->light_on = !game->light_on;
+        game->lcd->SetBacklight(game->light_on);
+        return true;
+    }
+    if (key == BRIGHTNESS_KEY)
+    {
+        game->brightness = static_cast<byte>((game->brightness + 1) % TM1637::MAX_BRIGHTNESS);
+        game->led_segments->SetBrightness(game->brightness);
+        return true;
+    }
+    return false;
 }
 
 auto Game::LCD_Char_Location_From_Player_Symbol(PlayerSymbol symbol) noexcept -> byte
@@ -76,6 +96,7 @@ inline void Game::Draw_Game() const noexcept
         lcd->SetCursor(row, FOURTH_COLUMN);
         lcd->PrintCustomChar(LOCATION_RIGHT);
     }
+    lcd->Flush();
 }
 
 inline void Game::Draw_Board_State() const noexcept
@@ -97,6 +118,7 @@ inline void Game::Draw_Board_State() const noexcept
         lcd->PrintCustomChar(LCD_Char_Location_From_Player_Symbol(
                 BoardManager::Instance()->GetGameBoard()[row][2]));
     }
+    lcd->Flush();
 }
 
 inline void Game::Print_Winner_And_Update_Score(PlayerSymbol winner) noexcept
@@ -126,6 +148,7 @@ inline void Game::Print_Winner_And_Update_Score(PlayerSymbol winner) noexcept
             lcd->PrintString(" player won");
         }
     }
+    lcd->Flush();
 
     sleep_ms(AFTER_WIN_DELAY);
 }
@@ -147,27 +170,17 @@ inline void Game::Print_First_Player_Info() const noexcept
     lcd->PrintCustomChar(LOCATION_SPACE);
     lcd->SetCursor(2, TEXT_START_COLUMN);
     lcd->PrintString("          ");
+    lcd->Flush();
 }
 
 inline void Game::Print_Second_Player_Info() const noexcept
 {
-    static constexpr size_t DOTS_START_COLUMN = 16;
-    static constexpr size_t DELAY = 200;
-
     if (second_player->GetStrategyName() != "HUMAN")
     {
         lcd->SetCursor(0, TEXT_START_COLUMN);
         lcd->PrintString("  Computer");
         lcd->SetCursor(1, TEXT_START_COLUMN);
         lcd->PrintString("thinking   ");
-        lcd->SetCursor(1, DOTS_START_COLUMN);
-        sleep_ms(DELAY);
-        lcd->PrintString(".");
-        sleep_ms(DELAY);
-        lcd->PrintString(".");
-        sleep_ms(DELAY);
-        lcd->PrintString(".");
-        sleep_ms(DELAY);
     }
     else
     {
@@ -186,6 +199,43 @@ inline void Game::Print_Second_Player_Info() const noexcept
             lcd->PrintCustomChar(LOCATION_0);
         }
     }
+    lcd->Flush();
+}
+
+auto Game::Get_Computer_Move() noexcept -> Move
+{
+    SearchWorker::Start(second_player->GetStrategy(), BoardManager::Instance()->GetGameBoard());
+
+    bool cancelled {false};
+    byte dots {0};
+
+    while (true)
+    {
+        auto const REPLY = SearchWorker::GetReply();
+        if (REPLY.type == SearchWorker::Message::MOVE)
+        {
+            return REPLY.move;
+        }
+        if (REPLY.type == SearchWorker::Message::PROGRESS)
+        {
+            for (auto const DOTS = static_cast<byte>(REPLY.done * DOTS_COUNT / REPLY.total); dots < DOTS; ++dots)
+            {
+                lcd->SetCursor(1, static_cast<byte>(DOTS_START_COLUMN + dots));
+                lcd->PrintString(".");
+            }
+            lcd->Flush();
+            continue;
+        }
+
+        if (!cancelled && Keypad::GetKey() == MOVE_NOW_KEY)
+        {
+            SearchWorker::Cancel();
+            cancelled = true;
+        }
+
+        // Both a reply and a key press wake the core up
+        __wfe();
+    }
 }
 
 void Game::Internal_Play() noexcept
@@ -242,7 +292,8 @@ void Game::Internal_Play() noexcept
             {
                 if (second_player_turn)
                 {
-                    auto move = second_player->GetNextMove(BoardManager::Instance()->GetGameBoard());
+                    auto move = (second_player->GetStrategyName() != "HUMAN") ? Get_Computer_Move() :
+                                second_player->GetNextMove(BoardManager::Instance()->GetGameBoard());
                     BoardManager::Instance()->GetGameBoard() = BoardManager::Instance()->GetResultBoard(
                             BoardManager::Instance()->GetGameBoard(), move, second_player->GetSymbol());
                     second_player_turn = false;
@@ -274,6 +325,7 @@ inline auto Game::Get_Difficulty() noexcept -> IPlayerStrategy *
     lcd->PrintString("difficulty ");
     lcd->SetCursor(3, TEXT_START_COLUMN);
     lcd->PrintString("           ");
+    lcd->Flush();
 
     do
     {
@@ -298,6 +350,7 @@ inline auto Game::Get_User() const noexcept -> PlayerSymbol
     lcd->PrintString("   ");
     lcd->SetCursor(2, TEXT_START_COLUMN);
     lcd->PrintString("           ");
+    lcd->Flush();
 
     do
     {
@@ -308,36 +361,6 @@ inline auto Game::Get_User() const noexcept -> PlayerSymbol
     return choice;
 }
 
-void Game::Key_Poller_Runner() noexcept
-{
-    bool light_on {false};
-    Key key {Key::UNKNOWN};
-    uint8_t brightness {0};
-
-    auto * keypad = reinterpret_cast<Keypad *> (multicore_fifo_pop_blocking());
-    auto * lcd = reinterpret_cast<LCD_I2C *>(multicore_fifo_pop_blocking());
-    auto * led_segments = reinterpret_cast<TM1637 *>(multicore_fifo_pop_blocking());
-
-    while (true)
-    {
-        key = keypad->GetKeyFromPoller();
-        if (key == Key::KEY13)
-        {
-            light_on = !light_on;
-            lcd->SetBacklight(light_on);
-        }
-        else if (key == Key::KEY14)
-        {
-            brightness = (++brightness) % TM1637::MAX_BRIGHTNESS;
-            led_segments->SetBrightness(brightness);
-        }
-        else
-        {
-            multicore_fifo_push_blocking(static_cast<uint32_t>(key));
-        }
-    }
-}
-
 inline void Game::Update_Scoreboard() const noexcept
 {
     led_segments->DisplayLeft(score.first, true);
@@ -382,6 +405,7 @@ inline void Game::Print_Difficulty(std::string_view diff) noexcept
     lcd->SetCursor(3, TEXT_START_COLUMN);
     lcd->PrintString("Diff:");
     lcd->PrintString(diff);
+    lcd->Flush();
 }
 
 void Game::Choose_Enemy() noexcept
@@ -394,6 +418,7 @@ void Game::Choose_Enemy() noexcept
     lcd->PrintString("HUMAN or AI");
     lcd->SetCursor(2, TEXT_START_COLUMN);
     lcd->PrintString("            ");
+    lcd->Flush();
 
     do
     {
@@ -424,6 +449,7 @@ void Game::Continue_After_Game() noexcept
     lcd->PrintString("same enemy?");
     lcd->SetCursor(3, TEXT_START_COLUMN);
     lcd->PrintString("            ");
+    lcd->Flush();
 
     do
     {
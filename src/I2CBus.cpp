@@ -0,0 +1,331 @@
+/*******************************************************************************
+ * @file I2CBus.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the I2CBus class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "I2CBus.hpp"
+
+#include <hardware/sync.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <pico/stdlib.h>
+
+#include <algorithm>
+
+std::array<I2CBus *, NUM_I2CS> I2CBus::owners {};
+
+I2CBus::I2CBus(i2c_inst * I2C, uint SDA, uint SCL) noexcept
+        : I2C_instance(I2C)
+{
+    critical_section_init(&lock);
+
+    baud_rate = i2c_init(I2C, SPEEDS.back());
+    byte_time = static_cast<uint32_t>(BYTE_BITS_NANOSECONDS / baud_rate);
+    gpio_set_function(SDA, GPIO_FUNC_I2C);
+    gpio_set_function(SCL, GPIO_FUNC_I2C);
+    gpio_pull_up(SDA);
+    gpio_pull_up(SCL);
+
+    dma_channel = static_cast<uint>(dma_claim_unused_channel(true));
+    auto config = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, i2c_get_dreq(I2C, true));
+    dma_channel_configure(dma_channel, &config, &i2c_get_hw(I2C)->data_cmd, nullptr, 0, false);
+
+    // The interrupts of the controller are only unmasked while a queued transfer is on the bus
+    auto const INDEX = i2c_hw_index(I2C);
+    i2c_get_hw(I2C)->intr_mask = 0;
+    owners[INDEX] = this;
+    irq_set_exclusive_handler(I2C0_IRQ + INDEX, (INDEX == 0) ? Handle_I2C0_Interrupt : Handle_I2C1_Interrupt);
+    irq_set_enabled(I2C0_IRQ + INDEX, true);
+}
+
+void I2CBus::Handle_I2C0_Interrupt() noexcept
+{
+    owners[0]->Handle_Interrupt();
+}
+
+void I2CBus::Handle_I2C1_Interrupt() noexcept
+{
+    owners[1]->Handle_Interrupt();
+}
+
+void I2CBus::Handle_Interrupt() noexcept
+{
+    static constexpr uint32_t NOT_ACKNOWLEDGED = I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS |
+                                                 I2C_IC_TX_ABRT_SOURCE_ABRT_TXDATA_NOACK_BITS;
+
+    auto * const hw = i2c_get_hw(I2C_instance);
+    auto const STATUS = hw->raw_intr_stat;
+
+    // A byte that is not acknowledged aborts the transfer: the controller flushes its FIFO and sends the STOP itself
+    if (STATUS & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS)
+    {
+        aborted = aborted || (hw->tx_abrt_source & NOT_ACKNOWLEDGED);
+        dma_channel_abort(dma_channel);
+        static_cast<void>(hw->clr_tx_abrt);
+    }
+
+    // Only the last word has the STOP bit, so the transfer is over once its STOP is on the bus
+    if (!(STATUS & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) || !(hw->status & I2C_IC_STATUS_TFE_BITS))
+    {
+        return;
+    }
+    static_cast<void>(hw->clr_stop_det);
+    hw->intr_mask = 0;
+
+    auto & owner = devices[current];
+    auto const TRANSFER = owner.transfer;
+
+    Record(current, TRANSFER.length, transfer_start, !aborted);
+    owner.pending.store(false);
+    current = NO_DEVICE;
+    busy.store(false);
+
+    TRANSFER.done(TRANSFER.context);
+    Start_Next();
+
+    // Wakes up a caller waiting for the bus
+    __sev();
+}
+
+void I2CBus::Set_Speed(uint speed) noexcept
+{
+    baud_rate = i2c_set_baudrate(I2C_instance, speed);
+    byte_time = static_cast<uint32_t>(BYTE_BITS_NANOSECONDS / baud_rate);
+}
+
+void I2CBus::Start_Next() noexcept
+{
+    // Whoever sets the flag owns the controller, and checks the devices again after releasing it so no transfer is stranded
+    while (Try_Acquire())
+    {
+        for (device offset = 0; offset < device_count; ++offset)
+        {
+            auto const HANDLE = static_cast<device>((next + offset) % device_count);
+            auto const & candidate = devices[HANDLE];
+            if (!candidate.pending.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            // The DMA channel only writes data, so the target address is set beforehand; the previous transfer has
+            // already ended on the bus, so the controller is idle
+            auto * const hw = i2c_get_hw(I2C_instance);
+            if (hw->tar != candidate.address)
+            {
+                hw->enable = 0;
+                hw->tar = candidate.address;
+                hw->enable = 1;
+            }
+
+            // A blocking read leaves its STOP detected
+            static_cast<void>(hw->clr_stop_det);
+            hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+
+            current = HANDLE;
+            aborted = false;
+            next = static_cast<device>((HANDLE + 1) % device_count);
+            transfer_start = time_us_64();
+            dma_channel_transfer_from_buffer_now(dma_channel, candidate.transfer.words,
+                                                 static_cast<uint32_t>(candidate.transfer.length));
+            return;
+        }
+
+        busy.store(false);
+
+        auto any_pending = false;
+        for (device handle = 0; handle < device_count; ++handle)
+        {
+            any_pending = any_pending || devices[handle].pending.load();
+        }
+        if (!any_pending)
+        {
+            return;
+        }
+    }
+}
+
+auto I2CBus::Try_Acquire() noexcept -> bool
+{
+    critical_section_enter_blocking(&lock);
+    auto const FREE = !busy.load(std::memory_order_relaxed);
+    if (FREE)
+    {
+        busy.store(true, std::memory_order_relaxed);
+    }
+    critical_section_exit(&lock);
+
+    return FREE;
+}
+
+void I2CBus::Acquire() noexcept
+{
+    while (!Try_Acquire())
+    {
+        __wfe();
+    }
+}
+
+void I2CBus::Release() noexcept
+{
+    busy.store(false);
+    Start_Next();
+
+    // Wakes up a caller waiting for the bus
+    __sev();
+}
+
+void I2CBus::Record(device handle, size_t length, uint64_t start, bool acknowledged) noexcept
+{
+    auto const DURATION = time_us_64() - start;
+
+    critical_section_enter_blocking(&lock);
+    auto & statistics = devices[handle].statistics;
+    statistics.bytes += acknowledged ? length : 0;
+    statistics.bus_time += DURATION;
+    ++statistics.transfers;
+    statistics.naks += acknowledged ? 0 : 1;
+    critical_section_exit(&lock);
+}
+
+auto I2CBus::AddDevice(uint8_t address, uint max_speed) noexcept -> device
+{
+    for (device handle = 0; handle < device_count; ++handle)
+    {
+        if (devices[handle].address == address)
+        {
+            devices[handle].max_speed = std::min(devices[handle].max_speed, max_speed);
+            return handle;
+        }
+    }
+
+    if (device_count == MAX_DEVICES)
+    {
+        return NO_DEVICE;
+    }
+    devices[device_count].address = address;
+    devices[device_count].max_speed = max_speed;
+    return device_count++;
+}
+
+auto I2CBus::Probe() noexcept -> uint
+{
+    Acquire();
+
+    // A device may acknowledge above its rated speed and still miss bits, so those speeds are never tried
+    auto rated_speed = SPEEDS.front();
+    for (device handle = 0; handle < device_count; ++handle)
+    {
+        rated_speed = std::min(rated_speed, devices[handle].max_speed);
+    }
+
+    for (uint const SPEED: SPEEDS)
+    {
+        if (SPEED > rated_speed && SPEED != SPEEDS.back())
+        {
+            continue;
+        }
+        Set_Speed(SPEED);
+
+        auto stable = true;
+        for (device handle = 0; handle < device_count && stable; ++handle)
+        {
+            for (uint8_t round = 0; round < PROBE_ROUNDS && stable; ++round)
+            {
+                uint8_t value {0};
+                stable = i2c_read_blocking(I2C_instance, devices[handle].address, &value, 1, false) == 1;
+            }
+        }
+        if (stable)
+        {
+            break;
+        }
+    }
+
+    // The slowest speed is kept even if a device does not answer at all
+    Release();
+    return baud_rate;
+}
+
+void I2CBus::Submit(device handle, entry const * words, size_t length, callback done, void * context) noexcept
+{
+    auto & owner = devices[handle];
+
+    owner.transfer = {words, length, done, context};
+    owner.pending.store(true, std::memory_order_release);
+    Start_Next();
+}
+
+auto I2CBus::Write(device handle, uint8_t const * data, size_t length) noexcept -> bool
+{
+    Acquire();
+    auto const START = time_us_64();
+    auto const ACKNOWLEDGED = i2c_write_blocking(I2C_instance, devices[handle].address, data, length, false) ==
+                              static_cast<int>(length);
+    Record(handle, length, START, ACKNOWLEDGED);
+    Release();
+    return ACKNOWLEDGED;
+}
+
+auto I2CBus::Read(device handle, uint8_t * data, size_t length) noexcept -> bool
+{
+    Acquire();
+    auto const START = time_us_64();
+    auto const ACKNOWLEDGED = i2c_read_blocking(I2C_instance, devices[handle].address, data, length, false) ==
+                              static_cast<int>(length);
+    Record(handle, length, START, ACKNOWLEDGED);
+    Release();
+    return ACKNOWLEDGED;
+}
+
+void I2CBus::WaitForIdle() const noexcept
+{
+    auto any_pending = true;
+    while (any_pending || busy.load())
+    {
+        any_pending = false;
+        for (device handle = 0; handle < device_count; ++handle)
+        {
+            any_pending = any_pending || devices[handle].pending.load();
+        }
+        if (any_pending || busy.load())
+        {
+            __wfe();
+        }
+    }
+}
+
+auto I2CBus::GetBaudRate() const noexcept -> uint
+{
+    return baud_rate;
+}
+
+auto I2CBus::GetByteTime() const noexcept -> uint32_t
+{
+    return byte_time;
+}
+
+auto I2CBus::GetDeviceCount() const noexcept -> device
+{
+    return device_count;
+}
+
+auto I2CBus::GetAddress(device handle) const noexcept -> uint8_t
+{
+    return devices[handle].address;
+}
+
+auto I2CBus::GetStatistics(device handle) noexcept -> Statistics
+{
+    critical_section_enter_blocking(&lock);
+    auto const STATISTICS = devices[handle].statistics;
+    critical_section_exit(&lock);
+    return STATISTICS;
+}
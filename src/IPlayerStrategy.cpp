@@ -8,6 +8,10 @@
  ******************************************************************************/
 
 #include "IPlayerStrategy.hpp"
+#include "OpeningBook.hpp"
+#include "PerfectPlay.hpp"
+#include "GridBoard.hpp"
+#include "Profiler.hpp"
 #include "Keypad.hpp"
 
 using Utility::PlayerSymbol;
@@ -25,13 +29,12 @@ inline auto IPlayerStrategy::Get_Random_Seed() noexcept -> uint32_t
 
     uint8_t next_byte = 0;
     uint32_t random = FNV_OFFSET_BASIS;
-    auto * volatile random_reg = reinterpret_cast<uint32_t *>(ROSC_BASE + ROSC_RANDOMBIT_OFFSET);
 
     for (size_t i = 0; i < NO_OF_ROUNDS; i++)
     {
         for (size_t k = 0; k < NO_OF_BYTES; k++)
         {
-            next_byte = static_cast<uint8_t>((next_byte << 1) | (*random_reg & 1));
+            next_byte = static_cast<uint8_t>((next_byte << 1) | (rosc_hw->randombit & 1U));
         }
         random ^= next_byte;
         random *= FNV_PRIME;
@@ -44,6 +47,41 @@ auto IPlayerStrategy::GetRNG() noexcept -> std::mt19937 &
     return random_number_generator;
 }
 
+void IPlayerStrategy::SetSearchMonitor(ISearchMonitor * monitor) noexcept
+{
+    search_monitor = monitor;
+}
+
+void IPlayerStrategy::Report_Progress(uint8_t done, uint8_t total) const noexcept
+{
+    if (search_monitor != nullptr)
+    {
+        search_monitor->ReportProgress(done, total);
+    }
+}
+
+auto IPlayerStrategy::Is_Cancelled() const noexcept -> bool
+{
+    return search_monitor != nullptr && search_monitor->IsCancelled();
+}
+
+auto IPlayerStrategy::Get_Random_Move(MoveList const & moves) noexcept -> Move
+{
+    std::uniform_int_distribution<uint16_t> distribution {0, static_cast<uint16_t>(moves.GetSize() - 1)};
+    return moves[static_cast<uint8_t>(distribution(GetRNG()))];
+}
+
+auto IPlayerStrategy::Get_Random_Move(BitBoard::mask cells) noexcept -> Move
+{
+    std::uniform_int_distribution<uint16_t> distribution {0, static_cast<uint16_t>(std::popcount(cells) - 1)};
+
+    for (auto skipped = distribution(GetRNG()); skipped != 0; --skipped)
+    {
+        cells &= cells - 1;
+    }
+    return BitBoard::MoveFromCell(static_cast<uint8_t>(std::countr_zero(cells)));
+}
+
 auto EasyStrategy::GetNextMove(Utility::Board const & current_board) noexcept -> Move
 {
     if (BoardManager::Instance()->IsTerminal(current_board))
@@ -51,10 +89,7 @@ auto EasyStrategy::GetNextMove(Utility::Board const & current_board) noexcept ->
         return {};
     }
 
-    auto actions = BoardManager::Instance()->GetActions(current_board);
-
-    std::sample(actions.begin(), actions.end(), std::back_inserter(actions), 1, GetRNG());
-    return actions.back();
+    return Get_Random_Move(BoardManager::Instance()->GetActions(current_board));
 }
 auto EasyStrategy::GetName() const noexcept -> std::string_view
 {
@@ -82,8 +117,7 @@ auto MediumStrategy::GetNextMove(Utility::Board const & current_board) noexcept
         }
     }
 
-    std::sample(actions.begin(), actions.end(), std::back_inserter(actions), 1, GetRNG());
-    return actions.back();
+    return Get_Random_Move(actions);
 }
 
 auto MediumStrategy::GetName() const noexcept -> std::string_view
@@ -91,122 +125,307 @@ auto MediumStrategy::GetName() const noexcept -> std::string_view
     return "MEDIUM";
 }
 
-auto HardStrategy::Get_Min_Value(Board const & current_board, Value alpha, Value beta) const noexcept -> Value
+HardStrategy::HardStrategy(Mode mode) noexcept : mode(mode) {}
+
+void HardStrategy::Count_Node(BitBoard const & current_board) noexcept
 {
-    if (BoardManager::Instance()->IsTerminal(current_board))
+    if constexpr (SearchStatistics::ENABLED)
     {
-        return BoardManager::Instance()->GetBoardValue(current_board);
+        ++statistics.nodes;
+        statistics.max_depth = std::max(statistics.max_depth, Get_Ply(current_board));
     }
+}
 
-    Value value = VALUE_MAX;
+auto HardStrategy::Get_Ply(BitBoard const & current_board) const noexcept -> uint8_t
+{
+    return static_cast<uint8_t>(current_board.GetMoveCount() - root_move_count);
+}
 
-    auto current_actions = BoardManager::Instance()->GetActions(current_board);
-    for (Move const & action: current_actions)
+auto HardStrategy::Order_Moves(BitBoard & current_board,
+                               PlayerSymbol player) const noexcept -> MovePicker<BitBoard::CELLS>
+{
+    static constexpr auto PRIORITIES = []
     {
-        value = std::min(value, Get_Max_Value(BoardManager::Instance()->
-                GetResultBoard(current_board, action, BoardManager::Instance()->
-                GetCurrentPlayer(current_board)), alpha, beta));
-        beta = std::min(beta, value);
-        if (value <= alpha)
+        std::array<uint8_t, BitBoard::CELLS> priorities {};
+        for (uint8_t cell = 0; cell < BitBoard::CELLS; ++cell)
         {
-            return value;
+            priorities[cell] = GridBoard<Utility::BOARD_SIZE, Utility::BOARD_SIZE>::GetLineCount(cell);
         }
+        return priorities;
+    }();
+
+    auto const OPPONENT = (player == PlayerSymbol::X) ? PlayerSymbol::O : PlayerSymbol::X;
+    auto const PLY = Get_Ply(current_board);
+    auto const ORDERED = orderer.GetOrdering() != MoveOrdering::NONE;
+
+    MovePicker<BitBoard::CELLS> picker {};
+    for (BitBoard::mask actions = current_board.GetEmpty(); actions != 0; actions &= actions - 1)
+    {
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+
+        auto tactic = Orderer::Tactic::QUIET;
+        if (ORDERED)
+        {
+            current_board.MakeMove(CELL, player);
+            auto const WINS = current_board.IsWinner(player);
+            current_board.UnmakeMove(CELL);
+
+            current_board.MakeMove(CELL, OPPONENT);
+            auto const BLOCKS = current_board.IsWinner(OPPONENT);
+            current_board.UnmakeMove(CELL);
+
+            tactic = WINS ? Orderer::Tactic::WIN : (BLOCKS ? Orderer::Tactic::BLOCK : Orderer::Tactic::QUIET);
+        }
+        picker.Add(CELL, orderer.Score(CELL, PLY, player, tactic, PRIORITIES[CELL]));
     }
-    return value;
+    return picker;
 }
 
-auto HardStrategy::Get_Max_Value(Board const & current_board, Value alpha, Value beta) const noexcept -> Value
+void HardStrategy::Count_Cutoff(BitBoard const & current_board, PlayerSymbol player) noexcept
 {
-    if (BoardManager::Instance()->IsTerminal(current_board))
+    if constexpr (SearchStatistics::ENABLED)
     {
-        return BoardManager::Instance()->GetBoardValue(current_board);
+        auto & cutoffs = (player == PlayerSymbol::X) ? statistics.beta_cutoffs : statistics.alpha_cutoffs;
+        ++cutoffs[Get_Ply(current_board)];
     }
+}
+
+auto HardStrategy::Get_Value(BitBoard & current_board, Value alpha, Value beta, Line & line) noexcept -> Value
+{
+    Count_Node(current_board);
+    line.Clear();
 
-    Value value = VALUE_MIN;
+    auto const PLAYER = current_board.GetCurrentPlayer();
 
-    auto current_actions = BoardManager::Instance()->GetActions(current_board);
-    for (Move const & action: current_actions)
+    if (current_board.IsTerminal())
     {
-        value = std::max(value, Get_Min_Value(BoardManager::Instance()->
-                GetResultBoard(current_board, action, BoardManager::Instance()->
-                GetCurrentPlayer(current_board)), alpha, beta));
+        if constexpr (SearchStatistics::ENABLED)
+        {
+            ++statistics.leaves;
+        }
+        auto const VALUE = current_board.GetValue();
+        return (PLAYER == PlayerSymbol::X) ? VALUE : static_cast<Value>(-VALUE);
+    }
+
+    auto const KEY = BoardManager::Canonicalise(current_board).first.GetKey();
+    auto const CACHED = transposition_table.Probe(KEY, alpha, beta);
+    if constexpr (SearchStatistics::ENABLED)
+    {
+        ++(CACHED ? statistics.tt_hits : statistics.tt_misses);
+    }
+    if (CACHED)
+    {
+        return *CACHED;
+    }
+
+    auto const INITIAL_ALPHA = alpha;
+
+    Value best_value = VALUE_MIN;
+    Line child_line {};
+    bool first_move = true;
+
+    auto picker = Order_Moves(current_board, PLAYER);
+    for (uint16_t cell = 0; picker.Next(cell);)
+    {
+        Value value = 0;
+
+        current_board.MakeMove(static_cast<uint8_t>(cell), PLAYER);
+        if (first_move)
+        {
+            value = static_cast<Value>(-Get_Value(current_board, static_cast<Value>(-beta),
+                                                  static_cast<Value>(-alpha), child_line));
+        }
+        else
+        {
+            value = static_cast<Value>(-Get_Value(current_board, static_cast<Value>(-alpha - 1),
+                                                  static_cast<Value>(-alpha), child_line));
+            if (value > alpha && value < beta)
+            {
+                if constexpr (SearchStatistics::ENABLED)
+                {
+                    ++statistics.researches;
+                }
+                value = static_cast<Value>(-Get_Value(current_board, static_cast<Value>(-beta),
+                                                      static_cast<Value>(-alpha), child_line));
+            }
+        }
+        current_board.UnmakeMove(static_cast<uint8_t>(cell));
+        first_move = false;
+
+        if (value > best_value)
+        {
+            best_value = value;
+            line.Set(cell, child_line);
+        }
+
         alpha = std::max(alpha, value);
         if (value >= beta)
         {
-            return value;
+            Count_Cutoff(current_board, PLAYER);
+            orderer.RecordCutoff(cell, Get_Ply(current_board), PLAYER,
+                                 static_cast<uint8_t>(BitBoard::CELLS - current_board.GetMoveCount()));
+            break;
         }
     }
-    return value;
+
+    transposition_table.Store(KEY, best_value, TranspositionTable::GetBound(best_value, INITIAL_ALPHA, beta));
+    return best_value;
 }
 
-auto HardStrategy::Get_Possible_Moves(Board const & current_board) const
--> std::unordered_map<Move, Value, Move::Hash>
+auto HardStrategy::Get_Possible_Moves(BitBoard & current_board) noexcept -> BitBoard::mask
 {
-    auto actions = BoardManager::Instance()->GetActions(current_board);
+    std::array<Value, BitBoard::CELLS> scores {};
+    scores.fill(VALUE_MIN);
+
+    Count_Node(current_board);
 
-    std::unordered_map<Move, Value, Move::Hash> possible_moves {};
-    if (BoardManager::Instance()->GetCurrentPlayer(current_board) == PlayerSymbol::X)
+    auto const PLAYER = current_board.GetCurrentPlayer();
+    auto const SYMMETRIES = BoardManager::GetSymmetries(current_board);
+    auto const ACTIONS = current_board.GetEmpty();
+    auto const TOTAL = static_cast<uint8_t>(std::popcount(ACTIONS));
+
+    // The moves that were not searched keep VALUE_MIN, below any real score
+    Value best_value = VALUE_MIN;
+    uint8_t done = 0;
+    for (BitBoard::mask actions = ACTIONS; actions != 0; actions &= actions - 1, ++done)
     {
-        Value max_value = VALUE_MIN;
-        for (Move const & action: actions)
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+        auto const REPRESENTATIVE = BoardManager::GetRepresentativeCell(CELL, SYMMETRIES);
+
+        if (REPRESENTATIVE != CELL)
         {
-            possible_moves.emplace(action, Get_Min_Value(BoardManager::Instance()->
-                    GetResultBoard(current_board, action, BoardManager::Instance()->
-                    GetCurrentPlayer(current_board)), VALUE_MIN, VALUE_MAX));
-            if (possible_moves[action] > max_value)
+            scores[CELL] = scores[REPRESENTATIVE];
+            continue;
+        }
+        if (done != 0)
+        {
+            Report_Progress(done, TOTAL);
+            if (Is_Cancelled())
             {
-                max_value = possible_moves[action];
+                break;
             }
         }
-        std::erase_if(possible_moves, [=](auto const & elem)
+
+        Line line {};
+        current_board.MakeMove(CELL, PLAYER);
+        scores[CELL] = static_cast<Value>(-Get_Value(current_board, VALUE_MIN, VALUE_MAX, line));
+        current_board.UnmakeMove(CELL);
+
+        root_lines[CELL].Set(CELL, line);
+        best_value = std::max(best_value, scores[CELL]);
+    }
+
+    BitBoard::mask best_moves = 0;
+    for (BitBoard::mask actions = ACTIONS; actions != 0; actions &= actions - 1)
+    {
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(actions));
+        if (scores[CELL] == best_value)
         {
-            return elem.second != max_value;
-        });
+            best_moves |= static_cast<BitBoard::mask>(1U << CELL);
+        }
     }
-    else
+    return best_moves;
+}
+
+void HardStrategy::Make_Principal_Variation(BitBoard current_board, uint8_t cell, bool from_table) noexcept
+{
+    principal_variation.Clear();
+
+    if (from_table)
     {
-        Value min_value = VALUE_MAX;
-        for (Move const & action: actions)
+        // Follow the table to the end of the game
+        for (auto next = cell; ; next = static_cast<uint8_t>(std::countr_zero(PerfectPlay::GetBestMoves(current_board))))
         {
-            possible_moves.emplace(action, Get_Max_Value(BoardManager::Instance()->
-                    GetResultBoard(current_board, action, BoardManager::Instance()->
-                    GetCurrentPlayer(current_board)), VALUE_MIN, VALUE_MAX));
-            if (possible_moves[action] < min_value)
+            principal_variation.Add(next);
+            current_board.MakeMove(next, current_board.GetCurrentPlayer());
+            if (current_board.IsTerminal())
             {
-                min_value = possible_moves[action];
+                return;
             }
         }
-        std::erase_if(possible_moves, [=](auto const & elem)
-        {
-            return elem.second != min_value;
-        });
     }
 
-    return possible_moves;
+    auto const SYMMETRIES = BoardManager::GetSymmetries(current_board);
+    auto const REPRESENTATIVE = BoardManager::GetRepresentativeCell(cell, SYMMETRIES);
+
+    // The symmetry that maps the cell to its representative leaves the board
+    // unchanged, so its inverse maps the whole line back
+    for (uint8_t symmetry = 0; symmetry < BoardManager::SYMMETRIES; ++symmetry)
+    {
+        if (((SYMMETRIES >> symmetry) & 1U) && BoardManager::TransformCell(cell, symmetry) == REPRESENTATIVE)
+        {
+            auto const INVERSE = BoardManager::GetInverseSymmetry(symmetry);
+            for (auto const MOVE: root_lines[REPRESENTATIVE])
+            {
+                principal_variation.Add(BoardManager::TransformCell(static_cast<uint8_t>(MOVE), INVERSE));
+            }
+            return;
+        }
+    }
 }
 
 auto HardStrategy::GetNextMove(Utility::Board const & current_board) noexcept -> Move
 {
-    if (BoardManager::Instance()->IsTerminal(current_board))
+    PROFILE_SCOPE(AI_MOVE);
+
+    BitBoard board {current_board};
+
+    if (board.IsTerminal())
     {
         return {};
     }
 
-    auto possible_moves = Get_Possible_Moves(current_board);
+    [[maybe_unused]] uint64_t start = 0;
+    if constexpr (SearchStatistics::ENABLED)
+    {
+        statistics = {};
+        start = time_us_64();
+    }
+    root_move_count = board.GetMoveCount();
+    orderer.Clear();
+
+    auto const BOOK_MOVES = (mode == Mode::SEARCH && opening_book) ? OpeningBook::GetBestMoves(board) :
+                                                                      BitBoard::mask {0};
+    auto const FROM_TABLE = mode == Mode::TABLE || BOOK_MOVES != 0;
 
-    std::vector<std::pair<Move, Value>> result {possible_moves.begin(), possible_moves.end()};
-    for (auto const &[ACTION, VALUE]: result)
+    BitBoard::mask best_moves = BOOK_MOVES;
+    if (mode == Mode::TABLE)
     {
-        if (BoardManager::Instance()->
-                IsWinner(BoardManager::Instance()->GetCurrentPlayer(current_board),
-                         BoardManager::Instance()->GetResultBoard(current_board, ACTION, BoardManager::Instance()->
-                                 GetCurrentPlayer(current_board))))
+        best_moves = PerfectPlay::GetBestMoves(board);
+    }
+    else if (BOOK_MOVES == 0)
+    {
+        best_moves = Get_Possible_Moves(board);
+    }
+
+    if constexpr (SearchStatistics::ENABLED)
+    {
+        statistics.elapsed = static_cast<uint32_t>(time_us_64() - start);
+    }
+
+    auto const PLAYER = board.GetCurrentPlayer();
+    for (BitBoard::mask moves = best_moves; moves != 0; moves &= moves - 1)
+    {
+        auto const CELL = static_cast<uint8_t>(std::countr_zero(moves));
+
+        board.MakeMove(CELL, PLAYER);
+        if (board.IsWinner(PLAYER))
         {
-            return ACTION;
+            board.UnmakeMove(CELL);
+            Make_Principal_Variation(board, CELL, FROM_TABLE);
+            return BitBoard::MoveFromCell(CELL);
         }
+        board.UnmakeMove(CELL);
     }
-    std::sample(result.begin(), result.end(), std::back_inserter(result), 1, GetRNG());
-    return result.back().first;
+
+    auto const MOVE = Get_Random_Move(best_moves);
+    Make_Principal_Variation(board, BitBoard::CellFromMove(MOVE), FROM_TABLE);
+    return MOVE;
+}
+
+auto HardStrategy::GetPrincipalVariation() const noexcept -> Line const &
+{
+    return principal_variation;
 }
 
 auto HardStrategy::GetName() const noexcept -> std::string_view
@@ -214,6 +433,109 @@ auto HardStrategy::GetName() const noexcept -> std::string_view
     return "HARD";
 }
 
+auto HardStrategy::GetTranspositionTable() noexcept -> TranspositionTable &
+{
+    return transposition_table;
+}
+
+auto HardStrategy::GetSearchStatistics() const noexcept -> SearchStatistics const &
+{
+    return statistics;
+}
+
+void HardStrategy::SetOpeningBook(bool enabled) noexcept
+{
+    opening_book = enabled;
+}
+
+auto HardStrategy::GetOpeningBook() const noexcept -> bool
+{
+    return opening_book;
+}
+
+void HardStrategy::SetMoveOrdering(MoveOrdering new_ordering) noexcept
+{
+    orderer.SetOrdering(new_ordering);
+}
+
+auto HardStrategy::GetMoveOrdering() const noexcept -> MoveOrdering
+{
+    return orderer.GetOrdering();
+}
+
+MctsStrategy::MctsStrategy(uint32_t playouts) noexcept : playouts(std::max(playouts, uint32_t {1})) {}
+
+auto MctsStrategy::GetNextMove(Utility::Board const & current_board) noexcept -> Move
+{
+    PROFILE_SCOPE(AI_MOVE);
+
+    BitBoard const BOARD {current_board};
+
+    if (BOARD.IsTerminal())
+    {
+        return {};
+    }
+
+    Search::Board board {};
+    for (uint8_t cell = 0; cell < BitBoard::CELLS; ++cell)
+    {
+        if (BOARD.GetCell(cell) != PlayerSymbol::UNK)
+        {
+            board.MakeMove(cell, BOARD.GetCell(cell));
+        }
+    }
+
+    search.SetSeed((uint64_t {GetRNG()()} << 32) | GetRNG()());
+    search.SetTimeBudget(time_budget);
+    search.Reset(board);
+
+    uint32_t done = 0;
+    for (uint8_t step = 1; step <= PROGRESS_STEPS; ++step)
+    {
+        auto const TARGET = static_cast<uint32_t>(uint64_t {playouts} * step / PROGRESS_STEPS);
+        auto const IN_TIME = search.Run(TARGET - done);
+        done = TARGET;
+
+        if (!IN_TIME || step == PROGRESS_STEPS)
+        {
+            break;
+        }
+        Report_Progress(step, PROGRESS_STEPS);
+        if (Is_Cancelled())
+        {
+            break;
+        }
+    }
+
+    // The root is expanded by the first playout, so there is always a move
+    return BitBoard::MoveFromCell(static_cast<uint8_t>(search.GetBestMove().move));
+}
+
+auto MctsStrategy::GetName() const noexcept -> std::string_view
+{
+    return "MCTS";
+}
+
+void MctsStrategy::SetPlayouts(uint32_t new_playouts) noexcept
+{
+    playouts = std::max(new_playouts, uint32_t {1});
+}
+
+auto MctsStrategy::GetPlayouts() const noexcept -> uint32_t
+{
+    return playouts;
+}
+
+void MctsStrategy::SetTimeBudget(uint32_t microseconds) noexcept
+{
+    time_budget = microseconds;
+}
+
+auto MctsStrategy::GetSearch() const noexcept -> Search const &
+{
+    return search;
+}
+
 auto HumanStrategy::GetNextMove(Utility::Board const & current_board) noexcept -> Move
 {
     static Move move;
@@ -8,6 +8,7 @@
  ******************************************************************************/
 
 #include "Keypad.hpp"
+#include "Profiler.hpp"
 
 using Utility::PlayerSymbol;
 
@@ -20,7 +21,7 @@ inline void Keypad::Init() noexcept
 {
     std::for_each(rows.begin(), rows.end(), gpio_init);
     std::for_each(rows.begin(), rows.end(), [](byte row) {gpio_set_dir(row, GPIO_OUT);});
-    std::for_each(rows.begin(), rows.end(), [](byte row) {gpio_put(row, LOW);});
+    std::for_each(rows.begin(), rows.end(), [](byte row) {gpio_put(row, HIGH);});
 
     std::for_each(columns.begin(), columns.end(), gpio_init);
     std::for_each(columns.begin(), columns.end(), [](byte column) {gpio_set_dir(column, GPIO_IN);});
@@ -28,53 +29,209 @@ inline void Keypad::Init() noexcept
 
     std::reverse(rows.begin(), rows.end());
     std::reverse(columns.begin(), columns.end());
+
+    interrupt_keypad = this;
+    std::for_each(columns.begin(), columns.end(), [](byte column)
+    {
+        gpio_set_irq_enabled_with_callback(column, GPIO_IRQ_EDGE_RISE, true, Key_Interrupt_Handler);
+    });
+}
+
+void Keypad::Set_Column_Interrupts(bool enabled) const noexcept
+{
+    std::for_each(columns.begin(), columns.end(), [enabled](byte column)
+    {
+        gpio_set_irq_enabled(column, GPIO_IRQ_EDGE_RISE, enabled);
+    });
+}
+
+auto Keypad::Is_Any_Closed() const noexcept -> bool
+{
+    return std::any_of(columns.begin(), columns.end(), [](byte column) {return gpio_get(column);});
 }
 
-auto Keypad::Key_Poller() const noexcept -> Key
+auto Keypad::Is_Closed(size_t row, size_t column) const noexcept -> bool
 {
-    static auto last_debounce_time = to_ms_since_boot(get_absolute_time());
-    static constexpr auto DELAY_TIME = 150;
+    std::for_each(rows.begin(), rows.end(), [](byte other_row) {gpio_put(other_row, LOW);});
+    gpio_put(rows[row], HIGH);
+    busy_wait_us_32(1);
+    auto const IS_CLOSED = gpio_get(columns[column]);
+    std::for_each(rows.begin(), rows.end(), [](byte other_row) {gpio_put(other_row, HIGH);});
 
-    if ((to_ms_since_boot(get_absolute_time()) - last_debounce_time) > DELAY_TIME)
+    return IS_CLOSED;
+}
+
+auto Keypad::Scan() const noexcept -> uint16_t
+{
+    // The columns are read before any row is driven low
+    std::array<bool, KEYPAD_SIZE> raised {};
+    std::transform(columns.begin(), columns.end(), raised.begin(), [](byte column) {return gpio_get(column);});
+
+    uint16_t closed = 0;
+    for (size_t column = 0; column < KEYPAD_SIZE; ++column)
     {
-        last_debounce_time = to_ms_since_boot(get_absolute_time());
+        if (!raised[column])
+        {
+            continue;
+        }
 
         #pragma GCC unroll 4
         for (size_t row = 0; row < KEYPAD_SIZE; ++row)
         {
-            #pragma GCC unroll 4
-            for (size_t column = 0; column < KEYPAD_SIZE; ++column)
+            if (Is_Closed(row, column))
             {
-                gpio_put(rows[row], HIGH);
-                sleep_us(1);
-                if (gpio_get(columns[column]))
-                {
-                    gpio_put(rows[row], LOW);
-                    return KEYS.at(row).at(column);
-                }
-                gpio_put(rows[row], LOW);
+                closed |= Key_Bit(KEYS.at(row).at(column));
             }
         }
     }
-    return Key::UNKNOWN;
+    return closed;
 }
 
-auto Keypad::GetKeyFromPoller() const noexcept -> Key
+void Keypad::Push_Key(Key key) noexcept
 {
-    Key key {Key::UNKNOWN};
+    auto const TAIL = queue_tail.load(std::memory_order_relaxed);
+    auto const NEXT_TAIL = static_cast<byte>((TAIL + 1) % KEY_QUEUE_SIZE);
 
-    do
+    if (NEXT_TAIL != queue_head.load(std::memory_order_acquire))
     {
-        key = Key_Poller();
+        key_queue[TAIL] = key;
+        queue_tail.store(NEXT_TAIL, std::memory_order_release);
     }
-    while (key == Key::UNKNOWN);
+}
 
-    return key;
+void Keypad::Queue_Changes(uint16_t closed) noexcept
+{
+    auto pressed = static_cast<uint16_t>(closed & ~held_keys);
+    auto const RELEASED = static_cast<uint16_t>(held_keys & ~closed);
+    held_keys = closed;
+
+#if TIC_TAC_TOE_PROFILING
+    static constexpr auto CHORD = static_cast<uint16_t>(Key_Bit(PROFILER_CHORD.first) |
+                                                        Key_Bit(PROFILER_CHORD.second));
+
+    if ((closed & CHORD) == CHORD && !chord_queued)
+    {
+        chord_queued = true;
+        Push_Key(Key::PROFILER_DUMP);
+    }
+    for (auto keys = static_cast<uint16_t>(RELEASED & CHORD); keys != 0 && !chord_queued;
+         keys &= static_cast<uint16_t>(keys - 1))
+    {
+        Push_Key(static_cast<Key>(std::countr_zero(keys)));
+    }
+    chord_queued = chord_queued && (closed & CHORD) != 0;
+    pressed &= static_cast<uint16_t>(~CHORD);
+#else
+    static_cast<void>(RELEASED);
+#endif
+
+    for (auto keys = pressed; keys != 0; keys &= static_cast<uint16_t>(keys - 1))
+    {
+        Push_Key(static_cast<Key>(std::countr_zero(keys)));
+    }
+}
+
+auto Keypad::Scan_Alarm_Handler(alarm_id_t id, void * user_data) noexcept -> int64_t
+{
+    static constexpr int64_t SCAN_TIME_US = SCAN_TIME * 1'000;
+
+    static_cast<void>(id);
+    static_cast<void>(user_data);
+
+    auto const CLOSED = interrupt_keypad->Scan();
+    Queue_Changes(CLOSED);
+
+    released_scans = (CLOSED == 0) ? static_cast<byte>(released_scans + 1) : 0;
+    if (released_scans < RELEASE_SCANS)
+    {
+        return SCAN_TIME_US;
+    }
+
+    // The scans raised the columns of the held keys, so their edges are
+    // cleared, then the columns are read again in case a key was pressed
+    // since the last scan
+    std::for_each(interrupt_keypad->columns.begin(), interrupt_keypad->columns.end(), [](byte column)
+    {
+        gpio_acknowledge_irq(column, GPIO_IRQ_EDGE_RISE);
+    });
+    if (interrupt_keypad->Is_Any_Closed())
+    {
+        released_scans = 0;
+        return SCAN_TIME_US;
+    }
+
+    released_scans = 0;
+    scanning.store(false);
+    interrupt_keypad->Set_Column_Interrupts(true);
+    return 0;
+}
+
+void Keypad::Key_Interrupt_Handler(uint gpio, uint32_t event_mask) noexcept
+{
+    static_cast<void>(gpio);
+    static_cast<void>(event_mask);
+
+    // Several columns can raise their edges at once, and only the first one
+    // sets the alarm
+    if (scanning.load())
+    {
+        return;
+    }
+    scanning.store(true);
+    interrupt_keypad->Set_Column_Interrupts(false);
+
+    if (add_alarm_in_ms(SCAN_TIME, Scan_Alarm_Handler, nullptr, true) < 0)
+    {
+        scanning.store(false);
+        interrupt_keypad->Set_Column_Interrupts(true);
+    }
+}
+
+void Keypad::SetKeyHandler(KeyHandler handler) noexcept
+{
+    key_handler = handler;
+}
+
+auto Keypad::GetKey() noexcept -> Key
+{
+    while (true)
+    {
+        auto const HEAD = queue_head.load(std::memory_order_relaxed);
+        if (HEAD == queue_tail.load(std::memory_order_acquire))
+        {
+            return Key::UNKNOWN;
+        }
+
+        auto const KEY = key_queue[HEAD];
+        queue_head.store(static_cast<byte>((HEAD + 1) % KEY_QUEUE_SIZE), std::memory_order_release);
+
+        if (KEY == Key::PROFILER_DUMP)
+        {
+            Profiler::Dump();
+        }
+        else if (Profiler::IsDumpShown())
+        {
+            // The key only dismisses the profiling results
+            Profiler::HideDump();
+        }
+        else if (key_handler == nullptr || !key_handler(KEY))
+        {
+            return KEY;
+        }
+    }
 }
 
 auto Keypad::GetPressedKey() noexcept -> Key
 {
-    return static_cast<Key>(multicore_fifo_pop_blocking());
+    auto key = GetKey();
+
+    // Any interrupt or event wakes the core up to check again
+    while (key == Key::UNKNOWN)
+    {
+        __wfe();
+        key = GetKey();
+    }
+    return key;
 }
 
 auto Keypad::ActionFromKey(Key key) noexcept -> Move
@@ -127,6 +284,8 @@ auto Keypad::DifficultyFromKey(Key key) noexcept -> IPlayerStrategy *
             return new MediumStrategy;
         case Key::KEY12:
             return new HardStrategy;
+        case Key::KEY16:
+            return new MctsStrategy;
         default:
             return nullptr;
     }
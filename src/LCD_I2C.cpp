@@ -8,73 +8,183 @@
  ******************************************************************************/
 
 #include "LCD_I2C.hpp"
+#include "Profiler.hpp"
 
-LCD_I2C::LCD_I2C(byte address, byte columns, byte rows, i2c_inst * I2C, uint SDA, uint SCL) noexcept
-        : address(address), columns(columns), rows(rows), backlight(NO_BACKLIGHT), I2C_instance(I2C)
-{
-    static constexpr size_t BAUD_RATE = 100'000;
+#include <hardware/sync.h>
+#include <pico/stdlib.h>
+
+#include <algorithm>
 
-    i2c_init(I2C, BAUD_RATE);
-    gpio_set_function(SDA, GPIO_FUNC_I2C);
-    gpio_set_function(SCL, GPIO_FUNC_I2C);
-    gpio_pull_up(SDA);
-    gpio_pull_up(SCL);
+LCD_I2C::LCD_I2C(I2CBus * bus, byte address, byte columns, byte rows) noexcept
+        : columns(std::min(columns, MAX_COLUMNS)), rows(std::min(rows, MAX_ROWS)), backlight(NO_BACKLIGHT), bus(bus),
+          device(bus->AddDevice(address, MAX_BUS_SPEED))
+{
+    critical_section_init(&sending_lock);
     Init();
 }
 
-inline void LCD_I2C::I2C_Write_Byte(byte val) const noexcept
+void LCD_I2C::Handle_Transfer_Done(void * context) noexcept
 {
-    static byte data;
+    auto * const lcd = static_cast<LCD_I2C *>(context);
 
-    data = val | backlight;
-    i2c_write_blocking(I2C_instance, address, &data, 1, false);
+    lcd->queue_tail.store(lcd->queue_tail.load(std::memory_order_relaxed) + lcd->sending_length,
+                          std::memory_order_release);
+    lcd->sending.store(false);
+    lcd->Start_Transfer();
 }
 
-void LCD_I2C::Pulse_Enable(byte val) const noexcept
+inline void LCD_I2C::Push(byte val) noexcept
 {
-    static constexpr uint16_t DELAY = 600;
+    auto const HEAD = queue_head.load(std::memory_order_relaxed);
+
+    while (HEAD - queue_tail.load(std::memory_order_acquire) == QUEUE_SIZE)
+    {
+        Start_Transfer();
+        __wfe();
+    }
+    queue[HEAD % QUEUE_SIZE] = val;
+    queue_head.store(HEAD + 1, std::memory_order_release);
+    last_port = val;
+}
 
-    sleep_us(DELAY);
-    I2C_Write_Byte(val | ENABLE);
-    sleep_us(DELAY);
-    I2C_Write_Byte(val & ~ENABLE);
-    sleep_us(DELAY);
+inline void LCD_I2C::I2C_Write_Byte(byte val) noexcept
+{
+    Push(val | backlight);
+    Start_Transfer();
 }
 
-inline void LCD_I2C::Send_Nibble(byte val) const noexcept
+constexpr auto LCD_I2C::Get_Execution_Time(byte val, byte mode) noexcept -> uint16_t
 {
-    I2C_Write_Byte(val);
-    Pulse_Enable(val);
+    if (mode != COMMAND)
+    {
+        return DATA_TIME;
+    }
+    return (val < ENTRY_MODE_SET) ? SLOW_TIME : INSTRUCTION_TIME;
 }
 
-inline void LCD_I2C::Send_Byte(byte val, byte mode) const noexcept
+inline auto LCD_I2C::Get_Idle_Bytes(uint16_t execution_time) const noexcept -> uint32_t
+{
+    // The enable pin rises again at the end of the next byte at the earliest
+    auto const BYTE_TIME = bus->GetByteTime();
+    auto const BUSY_BYTES = (execution_time * uint32_t {1'000} + BYTE_TIME - 1) / BYTE_TIME;
+    return (BUSY_BYTES > 1) ? BUSY_BYTES - 1 : 0;
+}
+
+inline void LCD_I2C::Queue_Nibble(byte val) noexcept
+{
+    auto const PORT = static_cast<byte>(val | backlight);
+
+    // The data lines only need to be stable when the enable pin falls
+    if ((PORT ^ last_port) & (REGISTER_SELECT | READ_WRITE))
+    {
+        Push(PORT);
+    }
+    Push(PORT | ENABLE);
+    Push(PORT & ~ENABLE);
+}
+
+inline void LCD_I2C::Queue_Byte(byte val, byte mode) noexcept
 {
     static constexpr byte UPPER_NIBBLE = 0B1111'0000;
 
-    static byte high;
-    static byte low;
+    Queue_Nibble((val & UPPER_NIBBLE) | mode);
+    Queue_Nibble(((val << 4) & UPPER_NIBBLE) | mode);
+
+    auto execution_time = Get_Execution_Time(val, mode);
+    if (TIC_TAC_TOE_LCD_BUSY_FLAG && mode == COMMAND && val < ENTRY_MODE_SET)
+    {
+        // Send_Command waits for the busy flag instead
+        execution_time = 0;
+    }
+    for (auto idle = Get_Idle_Bytes(execution_time); idle > 0; --idle)
+    {
+        Push(last_port);
+    }
+}
+
+inline void LCD_I2C::Queue_Command(byte val) noexcept
+{
+    Queue_Byte(val, COMMAND);
+}
 
-    high = val & UPPER_NIBBLE;
-    low = (val << 4) & UPPER_NIBBLE;
+inline void LCD_I2C::Queue_Char(byte val) noexcept
+{
+    Queue_Byte(val, CHAR);
+}
 
-    Send_Nibble(high | mode);
-    Send_Nibble(low | mode);
+void LCD_I2C::Start_Transfer() noexcept
+{
+    // Whoever sets the flag owns the transfer, and checks the queue again after releasing it so no bytes are stranded
+    while (Try_Take_Transfer())
+    {
+        auto const TAIL = queue_tail.load(std::memory_order_relaxed);
+        auto const HEAD = queue_head.load(std::memory_order_acquire);
+        if (HEAD != TAIL)
+        {
+            auto const START = TAIL % QUEUE_SIZE;
+            sending_length = std::min(HEAD - TAIL, QUEUE_SIZE - START);
+            queue[START + sending_length - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+            bus->Submit(device, &queue[START], sending_length, Handle_Transfer_Done, this);
+            return;
+        }
+
+        sending.store(false);
+        if (queue_head.load() == TAIL)
+        {
+            return;
+        }
+    }
 }
 
-inline void LCD_I2C::Send_Command(byte val) const noexcept
+auto LCD_I2C::Try_Take_Transfer() noexcept -> bool
 {
-    Send_Byte(val, COMMAND);
+    critical_section_enter_blocking(&sending_lock);
+    auto const FREE = !sending.load(std::memory_order_relaxed);
+    if (FREE)
+    {
+        sending.store(true, std::memory_order_relaxed);
+    }
+    critical_section_exit(&sending_lock);
+
+    return FREE;
 }
 
-inline void LCD_I2C::Send_Char(byte val) const noexcept
+void LCD_I2C::Send_Command(byte val) noexcept
 {
-    Send_Byte(val, CHAR);
+    Queue_Command(val);
+    Start_Transfer();
+
+#if TIC_TAC_TOE_LCD_BUSY_FLAG
+    if (val < ENTRY_MODE_SET)
+    {
+        WaitForIdle();
+        Wait_Until_Ready();
+    }
+#endif
 }
 
-void LCD_I2C::Send_Register_Select(byte val) const noexcept
+#if TIC_TAC_TOE_LCD_BUSY_FLAG
+void LCD_I2C::Wait_Until_Ready() noexcept
 {
-    Send_Byte(val, REGISTER_SELECT);
+    static constexpr byte DATA_LINES = 0B1111'0000;
+    static constexpr byte BUSY_FLAG = 0B1000'0000;
+
+    // Writing ones to the data lines releases them, so the display can drive them
+    auto const PORT = static_cast<byte>(DATA_LINES | READ_WRITE | backlight);
+    std::array const SETUP {PORT, static_cast<byte>(PORT | ENABLE)};
+    std::array const READ_LOW_NIBBLE {PORT, static_cast<byte>(PORT | ENABLE), PORT};
+
+    byte status {BUSY_FLAG};
+    while (status & BUSY_FLAG)
+    {
+        // The busy flag comes with the high nibble, the low one is read and discarded
+        bus->Write(device, SETUP.data(), SETUP.size());
+        bus->Read(device, &status, 1);
+        bus->Write(device, READ_LOW_NIBBLE.data(), READ_LOW_NIBBLE.size());
+    }
+    last_port = PORT;
 }
+#endif
 
 inline void LCD_I2C::Init() noexcept
 {
@@ -82,10 +192,18 @@ inline void LCD_I2C::Init() noexcept
     display_function = MODE_4_BIT | LINE_2 | DOTS_5x8;
     display_control = DISPLAY_ON | CURSOR_OFF | BLINK_OFF;
 
-    Send_Command(0x03);
-    Send_Command(0x03);
-    Send_Command(0x03);
-    Send_Command(0x02);
+    static constexpr std::array<byte, 4> RESET_NIBBLES {0x30, 0x30, 0x30, 0x20};
+    static constexpr uint16_t RESET_DELAY = 4'100;
+
+    #pragma GCC unroll 4
+    for (byte const RESET_NIBBLE: RESET_NIBBLES)
+    {
+        // The display may be in 8-bit mode, where a single nibble is a whole instruction, and its busy flag cannot be read
+        Queue_Nibble(RESET_NIBBLE | COMMAND);
+        Start_Transfer();
+        WaitForIdle();
+        sleep_us(RESET_DELAY);
+    }
 
     Send_Command(ENTRY_MODE_SET | display_mode);
     Send_Command(FUNCTION_SET | display_function);
@@ -94,6 +212,32 @@ inline void LCD_I2C::Init() noexcept
     Home();
 }
 
+inline auto LCD_I2C::Get_Address(byte row, byte column) const noexcept -> byte
+{
+    std::array const ROW_OFFSETS = {byte {0x00}, byte {0x40}, columns, static_cast<byte>(0x40 + columns)};
+
+    return static_cast<byte>(ROW_OFFSETS[row] + column);
+}
+
+inline void LCD_I2C::Put_Char(byte character) noexcept
+{
+    if (cursor_column >= columns)
+    {
+        return;
+    }
+
+    framebuffer[cursor_row * MAX_COLUMNS + cursor_column] = character;
+    if (display_mode & ENTRY_LEFT)
+    {
+        ++cursor_column;
+    }
+    else
+    {
+        // Moving left from the first column leaves the row, like moving right from the last one
+        cursor_column = (cursor_column == 0) ? columns : static_cast<byte>(cursor_column - 1);
+    }
+}
+
 void LCD_I2C::DisplayOn() noexcept
 {
     display_control |= DISPLAY_ON;
@@ -166,51 +310,131 @@ void LCD_I2C::SetTextRightToLeft() noexcept
     Send_Command(ENTRY_MODE_SET | display_mode);
 }
 
-void LCD_I2C::Clear() const noexcept
+void LCD_I2C::Clear() noexcept
 {
     Send_Command(CLEAR_DISPLAY);
+
+    // Clearing also brings the display back to left to right text
+    display_mode |= ENTRY_LEFT;
+    framebuffer.fill(' ');
+    displayed.fill(' ');
+    display_address = 0;
+    cursor_row = 0;
+    cursor_column = 0;
 }
 
-void LCD_I2C::Home() const noexcept
+void LCD_I2C::Home() noexcept
 {
     Send_Command(RETURN_HOME);
+
+    display_address = 0;
+    cursor_row = 0;
+    cursor_column = 0;
 }
 
-void LCD_I2C::SetCursor(byte row, byte column) const noexcept
+void LCD_I2C::SetCursor(byte row, byte column) noexcept
 {
-    static const std::array ROW_OFFSETS = {0x00, 0x40, 0x00 + columns, 0x40 + columns};
-
-    row = std::min(rows, row);
-    column = std::min(columns, column);
-    Send_Command(SET_DDRAM_ADDR | (ROW_OFFSETS.at(row) + column));
+    cursor_row = std::min(static_cast<byte>(rows - 1), row);
+    cursor_column = std::min(columns, column);
 }
 
-void LCD_I2C::PrintChar(byte character) const noexcept
+void LCD_I2C::PrintChar(byte character) noexcept
 {
-    Send_Char(character);
+    Put_Char(character);
 }
 
-void LCD_I2C::PrintString(std::string_view str) const noexcept
+void LCD_I2C::PrintString(std::string_view str) noexcept
 {
     for (char const CHARACTER: str)
     {
-        PrintChar(CHARACTER);
+        Put_Char(static_cast<byte>(CHARACTER));
     }
 }
 
-void LCD_I2C::PrintCustomChar(byte location) const noexcept
+void LCD_I2C::PrintCustomChar(byte location) noexcept
 {
-    Send_Register_Select(location);
+    Put_Char(location);
 }
 
-void LCD_I2C::CreateCustomChar(byte location, array const char_map) const noexcept
+void LCD_I2C::CreateCustomChar(byte location, array const char_map) noexcept
 {
     static constexpr byte MAX_CUSTOM_CHARS = 8;
 
     location = std::min(MAX_CUSTOM_CHARS, location);
-    Send_Command(SET_CGRAM_ADDR | (location << 3));
+    Queue_Command(SET_CGRAM_ADDR | (location << 3));
     for (size_t i = 0; i < CUSTOM_SYMBOL_SIZE; ++i)
     {
-        Send_Register_Select(char_map.at(i));
+        Queue_Char(char_map.at(i));
+    }
+    Start_Transfer();
+    display_address = NO_ADDRESS;
+}
+
+void LCD_I2C::Flush() noexcept
+{
+    PROFILE_SCOPE(LCD_PRINT);
+
+    // Cells are visited in the direction the display moves its cursor, so runs need no cursor command
+    auto const LEFT_TO_RIGHT = static_cast<bool>(display_mode & ENTRY_LEFT);
+    auto const & SHOWN = overlay_shown ? overlay : framebuffer;
+
+    for (byte row = 0; row < rows; ++row)
+    {
+        for (byte step = 0; step < columns; ++step)
+        {
+            auto const COLUMN = LEFT_TO_RIGHT ? step : static_cast<byte>(columns - 1 - step);
+            auto const CELL = row * MAX_COLUMNS + COLUMN;
+            if (SHOWN[CELL] == displayed[CELL])
+            {
+                continue;
+            }
+
+            auto const ADDRESS = Get_Address(row, COLUMN);
+            if (ADDRESS != display_address)
+            {
+                Queue_Command(SET_DDRAM_ADDR | ADDRESS);
+            }
+            Queue_Char(SHOWN[CELL]);
+            displayed[CELL] = SHOWN[CELL];
+            display_address = static_cast<byte>(LEFT_TO_RIGHT ? ADDRESS + 1 : ADDRESS - 1);
+        }
+    }
+    Start_Transfer();
+}
+
+void LCD_I2C::ShowOverlay(std::span<std::string_view const> lines) noexcept
+{
+    overlay.fill(' ');
+    for (byte row = 0; row < std::min<size_t>(rows, lines.size()); ++row)
+    {
+        auto const TEXT = lines[row].substr(0, columns);
+        std::copy(TEXT.begin(), TEXT.end(), overlay.begin() + row * MAX_COLUMNS);
+    }
+    overlay_shown = true;
+    Flush();
+}
+
+void LCD_I2C::HideOverlay() noexcept
+{
+    overlay_shown = false;
+    Flush();
+}
+
+auto LCD_I2C::IsOverlayShown() const noexcept -> bool
+{
+    return overlay_shown;
+}
+
+auto LCD_I2C::IsIdle() const noexcept -> bool
+{
+    return !sending.load() && queue_head.load() == queue_tail.load();
+}
+
+void LCD_I2C::WaitForIdle() const noexcept
+{
+    // The bus gives the entries back once their STOP is on the bus
+    while (!IsIdle())
+    {
+        __wfe();
     }
 }
@@ -25,8 +25,3 @@ auto Move::GetColumn() const noexcept -> int8_t
 {
     return std::tie(lhs.row, lhs.column) == std::tie(rhs.row, rhs.column);
 }
-
-auto Move::Hash::operator()(Move const & action) const noexcept -> std::size_t
-{
-    return std::hash<int8_t>()(action.row) ^ std::hash<int8_t>()(action.column);
-}
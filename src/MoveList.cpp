@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * @file MoveList.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the MoveList class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "MoveList.hpp"
+
+MoveList::MoveList(BitBoard::mask cells) noexcept
+{
+    for (cells &= BitBoard::FULL_MASK; cells != 0; cells &= cells - 1)
+    {
+        moves[size++] = BitBoard::MoveFromCell(static_cast<uint8_t>(std::countr_zero(cells)));
+    }
+}
+
+void MoveList::Add(Move const & action) noexcept
+{
+    if (size < CAPACITY)
+    {
+        moves[size++] = action;
+    }
+}
+
+auto MoveList::GetSize() const noexcept -> uint8_t
+{
+    return size;
+}
+
+auto MoveList::IsEmpty() const noexcept -> bool
+{
+    return size == 0;
+}
+
+auto MoveList::operator[](uint8_t index) const noexcept -> Move const &
+{
+    return moves[index];
+}
+
+auto MoveList::begin() const noexcept -> iterator
+{
+    return moves.begin();
+}
+
+auto MoveList::end() const noexcept -> iterator
+{
+    return moves.begin() + size;
+}
@@ -32,4 +32,9 @@ void Player::SetSymbol(PlayerSymbol player_symbol) noexcept
 auto Player::GetNextMove(Board const & current_board) noexcept -> Move
 {
     return strategy->GetNextMove(current_board);
-}
\ No newline at end of file
+}
+
+auto Player::GetStrategy() noexcept -> IPlayerStrategy &
+{
+    return *strategy;
+}
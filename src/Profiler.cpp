@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * @file Profiler.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the Profiler class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+critical_section_t Profiler::lock {};
+LCD_I2C * Profiler::display {nullptr};
+std::array<Profiler::Statistics, Profiler::SITES> Profiler::statistics {};
+std::array<Profiler::Sample, Profiler::HISTORY_SIZE> Profiler::history {};
+uint8_t Profiler::next_sample {0};
+
+Profiler::ScopedTimer::ScopedTimer(Site site) noexcept : site(site), start(time_us_64()) {}
+
+Profiler::ScopedTimer::~ScopedTimer() noexcept
+{
+    Record(site, static_cast<uint32_t>(std::min<uint64_t>(time_us_64() - start, UINT32_MAX)));
+}
+
+void Profiler::Init() noexcept
+{
+    critical_section_init(&lock);
+}
+
+void Profiler::SetDisplay(LCD_I2C * lcd) noexcept
+{
+    display = lcd;
+}
+
+void Profiler::Record(Site site, uint32_t duration) noexcept
+{
+    critical_section_enter_blocking(&lock);
+
+    auto & site_statistics = statistics[static_cast<size_t>(site)];
+    ++site_statistics.count;
+    site_statistics.min = std::min(site_statistics.min, duration);
+    site_statistics.max = std::max(site_statistics.max, duration);
+    site_statistics.total += duration;
+
+    history[next_sample] = {site, duration};
+    next_sample = static_cast<uint8_t>((next_sample + 1) % HISTORY_SIZE);
+
+    critical_section_exit(&lock);
+}
+
+auto Profiler::GetStatistics(Site site) noexcept -> Statistics
+{
+    critical_section_enter_blocking(&lock);
+    auto const SITE_STATISTICS = statistics[static_cast<size_t>(site)];
+    critical_section_exit(&lock);
+
+    return SITE_STATISTICS;
+}
+
+auto Profiler::GetHistory() noexcept -> std::array<Sample, HISTORY_SIZE>
+{
+    std::array<Sample, HISTORY_SIZE> samples {};
+
+    critical_section_enter_blocking(&lock);
+    std::rotate_copy(history.begin(), history.begin() + next_sample, history.end(), samples.begin());
+    critical_section_exit(&lock);
+
+    return samples;
+}
+
+void Profiler::Reset() noexcept
+{
+    critical_section_enter_blocking(&lock);
+    statistics.fill({});
+    history.fill({});
+    next_sample = 0;
+    critical_section_exit(&lock);
+}
+
+auto Profiler::GetSiteName(Site site) noexcept -> std::string_view
+{
+    switch (site)
+    {
+        case Site::AI_MOVE:
+            return "AI";
+        case Site::LCD_PRINT:
+            return "LC";
+        case Site::SCOREBOARD_SEND:
+            return "SB";
+        default:
+            return "??";
+    }
+}
+
+auto Profiler::Format_Duration(uint32_t duration) noexcept -> std::array<char, 6>
+{
+    static constexpr uint32_t MAX_MICROSECONDS = 99'999;
+    static constexpr uint32_t MAX_MILLISECONDS = 9'999;
+
+    std::array<char, 6> text {};
+
+    if (duration <= MAX_MICROSECONDS)
+    {
+        std::snprintf(text.data(), text.size(), "%5lu", static_cast<unsigned long>(duration));
+    }
+    else
+    {
+        std::snprintf(text.data(), text.size(), "%4lum",
+                      static_cast<unsigned long>(std::min(duration / 1'000, MAX_MILLISECONDS)));
+    }
+    return text;
+}
+
+void Profiler::Dump() noexcept
+{
+    if (display == nullptr)
+    {
+        return;
+    }
+
+    std::array<Statistics, SITES> snapshot {};
+
+    critical_section_enter_blocking(&lock);
+    snapshot = statistics;
+    critical_section_exit(&lock);
+
+    static constexpr size_t LINE_SIZE = 21;
+
+    std::array<std::array<char, LINE_SIZE>, SITES> texts {};
+    std::array<std::string_view, SITES + 1> lines {"us   min   avg   max"};
+
+    #pragma GCC unroll 3
+    for (uint8_t site = 0; site < SITES; ++site)
+    {
+        auto const & SITE_STATISTICS = snapshot[site];
+        auto const MIN = Format_Duration((SITE_STATISTICS.count == 0) ? 0 : SITE_STATISTICS.min);
+        auto const MEAN = Format_Duration(SITE_STATISTICS.GetMean());
+        auto const MAX = Format_Duration(SITE_STATISTICS.max);
+        auto const NAME = GetSiteName(static_cast<Site>(site));
+
+        std::snprintf(texts[site].data(), LINE_SIZE, "%.2s %s %s %s", NAME.data(), MIN.data(), MEAN.data(), MAX.data());
+        lines[site + 1] = texts[site].data();
+    }
+
+    // The game keeps drawing underneath, so hiding the dump shows its current screen
+    display->ShowOverlay(lines);
+}
+
+auto Profiler::IsDumpShown() noexcept -> bool
+{
+    return display != nullptr && display->IsOverlayShown();
+}
+
+void Profiler::HideDump() noexcept
+{
+    if (IsDumpShown())
+    {
+        display->HideOverlay();
+    }
+}
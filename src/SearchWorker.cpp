@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * @file SearchWorker.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the SearchWorker class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "SearchWorker.hpp"
+
+using Utility::PlayerSymbol;
+
+void SearchWorker::Launch() noexcept
+{
+    multicore_launch_core1(Run);
+}
+
+void SearchWorker::Run() noexcept
+{
+    SearchWorker worker {};
+
+    while (true)
+    {
+        auto const REQUEST = multicore_fifo_pop_blocking();
+        if (Get_Type(REQUEST) != Message::SEARCH)
+        {
+            continue;
+        }
+
+        auto const PAYLOAD = Get_Payload(REQUEST);
+        BitBoard const BOARD {static_cast<BitBoard::mask>(PAYLOAD & BitBoard::FULL_MASK),
+                              static_cast<BitBoard::mask>(PAYLOAD >> BitBoard::CELLS)};
+
+        auto * const PLAYER_STRATEGY = strategy.load(std::memory_order_acquire);
+
+        worker.cancelled = false;
+        PLAYER_STRATEGY->SetSearchMonitor(&worker);
+        auto const MOVE = PLAYER_STRATEGY->GetNextMove(BOARD.ToBoard());
+        PLAYER_STRATEGY->SetSearchMonitor(nullptr);
+
+        multicore_fifo_push_blocking(Pack(Message::MOVE, BitBoard::CellFromMove(MOVE)));
+    }
+}
+
+void SearchWorker::Start(IPlayerStrategy & player_strategy, Utility::Board const & current_board) noexcept
+{
+    BitBoard const BOARD {current_board};
+
+    strategy.store(&player_strategy, std::memory_order_release);
+    multicore_fifo_push_blocking(Pack(Message::SEARCH, BOARD.GetMask(PlayerSymbol::X) |
+                                      (uint32_t {BOARD.GetMask(PlayerSymbol::O)} << BitBoard::CELLS)));
+}
+
+void SearchWorker::Cancel() noexcept
+{
+    multicore_fifo_push_blocking(Pack(Message::CANCEL, 0));
+}
+
+auto SearchWorker::GetReply() noexcept -> Reply
+{
+    if (!multicore_fifo_rvalid())
+    {
+        return {};
+    }
+
+    auto const MESSAGE = multicore_fifo_pop_blocking();
+    auto const PAYLOAD = Get_Payload(MESSAGE);
+
+    switch (Get_Type(MESSAGE))
+    {
+        case Message::PROGRESS:
+            return {Message::PROGRESS, static_cast<uint8_t>(PAYLOAD >> DONE_SHIFT), static_cast<uint8_t>(PAYLOAD),
+                    {}};
+        case Message::MOVE:
+            return {Message::MOVE, 0, 0, BitBoard::MoveFromCell(static_cast<uint8_t>(PAYLOAD))};
+        default:
+            return {};
+    }
+}
+
+void SearchWorker::ReportProgress(uint8_t done, uint8_t total) noexcept
+{
+    if (multicore_fifo_wready())
+    {
+        multicore_fifo_push_blocking(Pack(Message::PROGRESS, (uint32_t {done} << DONE_SHIFT) | total));
+    }
+}
+
+auto SearchWorker::IsCancelled() noexcept -> bool
+{
+    // The first core sends nothing else while a search runs
+    while (!cancelled && multicore_fifo_rvalid())
+    {
+        cancelled = Get_Type(multicore_fifo_pop_blocking()) == Message::CANCEL;
+    }
+    return cancelled;
+}
@@ -8,6 +8,7 @@
  ******************************************************************************/
 
 #include "TM1637.hpp"
+#include "Profiler.hpp"
 
 TM1637::TM1637(byte DIO, byte CLK, PIO pio) noexcept : pio(pio)
 {
@@ -62,6 +63,8 @@ inline void TM1637::Set_Clock_Divider() noexcept
 
 void TM1637::Send_4_Bytes(data value) const noexcept
 {
+    PROFILE_SCOPE(SCOREBOARD_SEND);
+
     static constexpr size_t BIT_MASK = 0xFF'FF;
     static constexpr size_t SHIFT_POSITIONS = 16;
 
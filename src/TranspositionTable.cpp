@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * @file TranspositionTable.cpp
+ * @author Cristian Cristea
+ * @date October 16, 2026
+ * @brief Source file for the TranspositionTable class.
+ *
+ * @copyright Copyright (C) 2021 Cristian Cristea. All rights reserved.
+ ******************************************************************************/
+
+#include "TranspositionTable.hpp"
+
+using Utility::Value;
+
+auto TranspositionTable::Probe(BitBoard::key key, Value alpha, Value beta) noexcept -> std::optional<Value>
+{
+    auto const & ENTRY = entries[key % SIZE];
+
+    if (ENTRY.key == key)
+    {
+        if ((ENTRY.bound == Bound::EXACT) || (ENTRY.bound == Bound::LOWER && ENTRY.value >= beta) ||
+                (ENTRY.bound == Bound::UPPER && ENTRY.value <= alpha))
+        {
+            ++hits;
+            return ENTRY.value;
+        }
+    }
+
+    ++misses;
+    return std::nullopt;
+}
+
+void TranspositionTable::Store(BitBoard::key key, Value value, Bound bound) noexcept
+{
+    entries[key % SIZE] = {key, value, bound};
+}
+
+auto TranspositionTable::GetBound(Value value, Value alpha, Value beta) noexcept -> Bound
+{
+    if (value <= alpha)
+    {
+        return Bound::UPPER;
+    }
+    if (value >= beta)
+    {
+        return Bound::LOWER;
+    }
+    return Bound::EXACT;
+}
+
+void TranspositionTable::Clear() noexcept
+{
+    entries.fill({});
+}
+
+auto TranspositionTable::GetHits() const noexcept -> uint32_t
+{
+    return hits;
+}
+
+auto TranspositionTable::GetMisses() const noexcept -> uint32_t
+{
+    return misses;
+}
+
+void TranspositionTable::ResetCounters() noexcept
+{
+    hits = 0;
+    misses = 0;
+}
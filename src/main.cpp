@@ -30,8 +30,15 @@ int main()
     bi_decl(bi_1pin_with_name(KEYPAD_COLUMNS[2], "[C3] Keypad third column pin"))
     bi_decl(bi_1pin_with_name(KEYPAD_COLUMNS[3], "[C4] Keypad fourth column pin"))
 
+    Profiler::Init();
+
+    // The bus runs at the fastest speed the display keeps up with, up to its rated speed
+    static I2CBus bus {I2C, SDA, SCL};
+    bus.AddDevice(I2C_ADDRESS, LCD_I2C::MAX_BUS_SPEED);
+    bus.Probe();
+
     auto game = std::make_unique<Game>(
-            new LCD_I2C {I2C_ADDRESS, LCD_COLUMNS, LCD_ROWS, I2C, SDA, SCL},
+            new LCD_I2C {&bus, I2C_ADDRESS, LCD_COLUMNS, LCD_ROWS},
             new TM1637 {DIO, CLK, pio},
             new Keypad {KEYPAD_ROWS, KEYPAD_COLUMNS});
 